@@ -0,0 +1,430 @@
+/**
+ * @file autocomplete.c
+ * @brief source file for the name autocomplete of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <limits.h>
+#include "autocomplete.h"
+#include "companytable.h"
+
+/**
+ * @brief The nodes of the tree, by table slot of their company: the company, -1 or the slots of
+ * its children, and the slot of the best rated company in its subtree. nodeCompany is NULL for
+ * the slots of companies not in the index.
+ */
+static Company **nodeCompany = NULL;
+static int *leftChild = NULL;
+static int *rightChild = NULL;
+static int *bestInSubtree = NULL;
+static int nodesCapacity = 0;
+static int root = -1;
+
+/**
+ * @brief A range of names still holding completions, between two keys left out, with its best
+ * rated company.
+ */
+typedef struct {
+    const Company *low;
+    const Company *high;
+    int best;
+} CompletionRun;
+
+    static int compareNames(const Company *a, const Company *b) {
+        int order = strcmp(a->nameKey, b->nameKey);
+
+        if (order != 0) {
+            return order;
+        }
+        return (a->tableSlot > b->tableSlot) - (a->tableSlot < b->tableSlot);
+    }
+
+    /*
+     * Priority of a node in the heap order of the tree. It only has to look random, so the
+     * table slot is mixed (the finalizer of MurmurHash3) instead of drawing a number.
+     */
+    static unsigned int nodePriority(int slot) {
+        unsigned int hash = (unsigned int) slot;
+
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bu;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    /*
+     * Returns the slot of the more relevant of two companies: higher average, then more
+     * ratings, then lower NIF, as in the leaderboards.
+     */
+    static int moreRelevant(int a, int b) {
+        if (a < 0 || b < 0) {
+            return a < 0 ? b : a;
+        }
+
+        const RatingAggregate *ratingsA = &nodeCompany[a]->ratings;
+        const RatingAggregate *ratingsB = &nodeCompany[b]->ratings;
+        float averageA = calculateAverageRating(ratingsA);
+        float averageB = calculateAverageRating(ratingsB);
+
+        if (averageA != averageB) {
+            return averageA > averageB ? a : b;
+        }
+        if (ratingsA->count != ratingsB->count) {
+            return ratingsA->count > ratingsB->count ? a : b;
+        }
+        return nodeCompany[a]->nif <= nodeCompany[b]->nif ? a : b;
+    }
+
+    static int compareNameEntries(const void *a, const void *b) {
+        return compareNames(*(Company * const *) a, *(Company * const *) b);
+    }
+
+    static int subtreeBest(int node) {
+        return node < 0 ? -1 : bestInSubtree[node];
+    }
+
+    static void updateBest(int node) {
+        bestInSubtree[node] = moreRelevant(node, moreRelevant(subtreeBest(leftChild[node]), subtreeBest(rightChild[node])));
+    }
+
+    static int rotateRight(int node) {
+        int child = leftChild[node];
+
+        leftChild[node] = rightChild[child];
+        rightChild[child] = node;
+        updateBest(node);
+        updateBest(child);
+        return child;
+    }
+
+    static int rotateLeft(int node) {
+        int child = rightChild[node];
+
+        rightChild[node] = leftChild[child];
+        leftChild[child] = node;
+        updateBest(node);
+        updateBest(child);
+        return child;
+    }
+
+    /*
+     * Inserts a node below the given one by its name, then rotates it up while its priority is
+     * higher than its parent's. Returns the new root of the subtree.
+     */
+    static int insertNode(int node, int slot) {
+        if (node < 0) {
+            return slot;
+        }
+
+        if (compareNames(nodeCompany[slot], nodeCompany[node]) < 0) {
+            leftChild[node] = insertNode(leftChild[node], slot);
+            if (nodePriority(leftChild[node]) > nodePriority(node)) {
+                return rotateRight(node);
+            }
+        } else {
+            rightChild[node] = insertNode(rightChild[node], slot);
+            if (nodePriority(rightChild[node]) > nodePriority(node)) {
+                return rotateLeft(node);
+            }
+        }
+        updateBest(node);
+        return node;
+    }
+
+    /*
+     * Joins two subtrees, every name of the first sorting before every name of the second.
+     */
+    static int mergeNodes(int first, int second) {
+        if (first < 0 || second < 0) {
+            return first < 0 ? second : first;
+        }
+
+        if (nodePriority(first) > nodePriority(second)) {
+            rightChild[first] = mergeNodes(rightChild[first], second);
+            updateBest(first);
+            return first;
+        }
+        leftChild[second] = mergeNodes(first, leftChild[second]);
+        updateBest(second);
+        return second;
+    }
+
+    static int removeNode(int node, const Company *company) {
+        if (node < 0) {
+            return -1;
+        }
+
+        int order = compareNames(company, nodeCompany[node]);
+        if (order == 0) {
+            return mergeNodes(leftChild[node], rightChild[node]);
+        }
+
+        if (order < 0) {
+            leftChild[node] = removeNode(leftChild[node], company);
+        } else {
+            rightChild[node] = removeNode(rightChild[node], company);
+        }
+        updateBest(node);
+        return node;
+    }
+
+    static void updateBestInSubtree(int node) {
+        if (node >= 0) {
+            updateBestInSubtree(leftChild[node]);
+            updateBestInSubtree(rightChild[node]);
+            updateBest(node);
+        }
+    }
+
+    /*
+     * Recomputes the best rated company of the nodes on the way to a company, from the bottom up.
+     */
+    static void updateBestOnPath(int node, const Company *company) {
+        if (node < 0) {
+            return;
+        }
+
+        int order = compareNames(company, nodeCompany[node]);
+        if (order < 0) {
+            updateBestOnPath(leftChild[node], company);
+        } else if (order > 0) {
+            updateBestOnPath(rightChild[node], company);
+        }
+        updateBest(node);
+    }
+
+    /*
+     * Best rated company whose name sorts strictly between low and high.
+     */
+    static int findBestInRange(const Company *low, const Company *high) {
+        int node = root;
+
+        // Going down to the first node inside the range; the range lies below it on both sides.
+        while (node >= 0) {
+            if (compareNames(nodeCompany[node], low) <= 0) {
+                node = rightChild[node];
+            } else if (compareNames(nodeCompany[node], high) >= 0) {
+                node = leftChild[node];
+            } else {
+                break;
+            }
+        }
+        if (node < 0) {
+            return -1;
+        }
+
+        // On the left side, each node after low brings its right subtree whole; on the right
+        // side, each node before high brings its left subtree whole.
+        int best = node;
+        for (int i = leftChild[node]; i >= 0;) {
+            if (compareNames(nodeCompany[i], low) > 0) {
+                best = moreRelevant(best, moreRelevant(i, subtreeBest(rightChild[i])));
+                i = leftChild[i];
+            } else {
+                i = rightChild[i];
+            }
+        }
+        for (int i = rightChild[node]; i >= 0;) {
+            if (compareNames(nodeCompany[i], high) < 0) {
+                best = moreRelevant(best, moreRelevant(i, subtreeBest(leftChild[i])));
+                i = rightChild[i];
+            } else {
+                i = leftChild[i];
+            }
+        }
+        return best;
+    }
+
+    static int reserveNodes(int count) {
+        if (count <= nodesCapacity) {
+            return 1;
+        }
+
+        int capacity = nodesCapacity > 0 ? nodesCapacity : INITIAL_BUFFER_SIZE;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+
+        Company **companies = realloc(nodeCompany, capacity * sizeof(Company *));
+        if (companies != NULL) {
+            nodeCompany = companies;
+        }
+        int *left = companies != NULL ? realloc(leftChild, capacity * sizeof(int)) : NULL;
+        if (left != NULL) {
+            leftChild = left;
+        }
+        int *right = left != NULL ? realloc(rightChild, capacity * sizeof(int)) : NULL;
+        if (right != NULL) {
+            rightChild = right;
+        }
+        int *best = right != NULL ? realloc(bestInSubtree, capacity * sizeof(int)) : NULL;
+
+        if (best == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        bestInSubtree = best;
+        for (int i = nodesCapacity; i < capacity; i++) {
+            nodeCompany[i] = NULL;
+        }
+        nodesCapacity = capacity;
+        return 1;
+    }
+
+    void buildNameCompletions(const CompanyTable *companies) {
+        int numNodes = 0;
+        int maxSlot = -1;
+
+        freeNameCompletions();
+        for (int i = 0; i < companies->count; i++) {
+            if (companyAt(companies, i)->tableSlot > maxSlot) {
+                maxSlot = companyAt(companies, i)->tableSlot;
+            }
+        }
+
+        Company **sorted = malloc((companies->count + 1) * sizeof(Company *));
+        int *stack = sorted != NULL ? malloc((companies->count + 1) * sizeof(int)) : NULL;
+        if (stack == NULL || !reserveNodes(maxSlot + 1)) {
+            if (stack == NULL) {
+                printf("Memory allocation error.\n");
+            }
+            free(sorted);
+            free(stack);
+            return;
+        }
+
+        for (int i = 0; i < companies->count; i++) {
+            Company *company = companyAt(companies, i);
+            if (company->tableSlot >= 0 && nodeCompany[company->tableSlot] == NULL) {
+                nodeCompany[company->tableSlot] = company;
+                sorted[numNodes++] = company;
+            }
+        }
+        qsort(sorted, numNodes, sizeof(Company *), compareNameEntries);
+
+        // With the names in order, the tree is built in one pass: the stack holds its right
+        // edge, and each node takes as left child the nodes of lower priority it pops.
+        int height = 0;
+
+        for (int i = 0; i < numNodes; i++) {
+            int slot = sorted[i]->tableSlot;
+            int popped = -1;
+
+            while (height > 0 && nodePriority(stack[height - 1]) < nodePriority(slot)) {
+                popped = stack[--height];
+            }
+            leftChild[slot] = popped;
+            rightChild[slot] = -1;
+            if (height > 0) {
+                rightChild[stack[height - 1]] = slot;
+            }
+            stack[height++] = slot;
+        }
+
+        root = numNodes > 0 ? stack[0] : -1;
+        updateBestInSubtree(root);
+        free(sorted);
+        free(stack);
+    }
+
+    void indexCompanyName(Company *company) {
+        int slot = company->tableSlot;
+
+        if (slot < 0 || !reserveNodes(slot + 1) || nodeCompany[slot] != NULL) {
+            return;
+        }
+
+        nodeCompany[slot] = company;
+        leftChild[slot] = -1;
+        rightChild[slot] = -1;
+        bestInSubtree[slot] = slot;
+        root = insertNode(root, slot);
+    }
+
+    void unindexCompanyName(const Company *company) {
+        int slot = company->tableSlot;
+
+        if (slot < 0 || slot >= nodesCapacity || nodeCompany[slot] != company) {
+            return;
+        }
+
+        root = removeNode(root, company);
+        nodeCompany[slot] = NULL;
+    }
+
+    void updateCompanyNameRating(const Company *company) {
+        int slot = company->tableSlot;
+
+        if (slot >= 0 && slot < nodesCapacity && nodeCompany[slot] == company) {
+            updateBestOnPath(root, company);
+        }
+    }
+
+    int completeCompanyName(const char *prefix, int maxResults, Company *results[]) {
+        Company low;
+        Company high;
+        int found = 0;
+
+        if (root < 0 || maxResults <= 0) {
+            return 0;
+        }
+
+        // Every name starting with the prefix sorts after the prefix itself and before the
+        // prefix followed by the highest byte up to the longest key.
+        foldText(low.nameKey, sizeof(low.nameKey), prefix);
+        low.tableSlot = -1;
+        size_t length = strlen(low.nameKey);
+        memcpy(high.nameKey, low.nameKey, length);
+        memset(high.nameKey + length, 0xff, sizeof(high.nameKey) - 1 - length);
+        high.nameKey[sizeof(high.nameKey) - 1] = '\0';
+        high.tableSlot = INT_MAX;
+
+        // Each completion taken splits its run in two, so there are never more than maxResults + 1 runs.
+        CompletionRun runs[maxResults + 1];
+        int numRuns = 0;
+        int best = findBestInRange(&low, &high);
+
+        if (best >= 0) {
+            runs[numRuns++] = (CompletionRun) {&low, &high, best};
+        }
+
+        while (found < maxResults && numRuns > 0) {
+            int chosen = 0;
+            for (int i = 1; i < numRuns; i++) {
+                if (moreRelevant(runs[chosen].best, runs[i].best) == runs[i].best) {
+                    chosen = i;
+                }
+            }
+
+            CompletionRun run = runs[chosen];
+            const Company *company = nodeCompany[run.best];
+            runs[chosen] = runs[--numRuns];
+            results[found++] = (Company *) company;
+
+            if ((best = findBestInRange(run.low, company)) >= 0) {
+                runs[numRuns++] = (CompletionRun) {run.low, company, best};
+            }
+            if ((best = findBestInRange(company, run.high)) >= 0) {
+                runs[numRuns++] = (CompletionRun) {company, run.high, best};
+            }
+        }
+        return found;
+    }
+
+    void freeNameCompletions() {
+        free(nodeCompany);
+        free(leftChild);
+        free(rightChild);
+        free(bestInSubtree);
+        nodeCompany = NULL;
+        leftChild = NULL;
+        rightChild = NULL;
+        bestInSubtree = NULL;
+        nodesCapacity = 0;
+        root = -1;
+    }
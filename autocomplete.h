@@ -0,0 +1,92 @@
+/**
+ * @file autocomplete.h
+ * @brief Header file for the name autocomplete of the Company Management System.
+ *
+ * The companies are kept in a binary search tree ordered by the folded key of their name (see
+ * foldText), so the names starting with a prefix form one range of keys. The tree is a treap:
+ * its nodes are also in heap order of a priority mixed from their table slot, which keeps its
+ * depth logarithmic on average, and a name is added, removed or re-rated in O(log n) without
+ * moving the others. Each node holds the best rated company of its subtree, so the best rated
+ * company of any range of keys is found in O(log n). The completions are taken one at a time:
+ * the best of the range, then the best of the two ranges left on each side of it, and so on,
+ * which costs O(k log n) for k completions however many names share the prefix.
+ *
+ * The index is updated when a company is created, renamed or removed, and the tree when a
+ * company is rated.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef AUTOCOMPLETE_H
+#define AUTOCOMPLETE_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Number of completions shown for a prefix.
+     */
+    #define MAX_COMPLETIONS 10
+
+    /**
+     * @brief Builds the index from every company of the table.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void buildNameCompletions(const CompanyTable* companies);
+
+    /**
+     * @brief Adds the name of a company to the index.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void indexCompanyName(Company* company);
+
+    /**
+     * @brief Removes the name of a company from the index.
+     *
+     * Must be called before the name is changed, or before the company is removed.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void unindexCompanyName(const Company* company);
+
+    /**
+     * @brief Updates the place of a company among the completions after it was rated.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void updateCompanyNameRating(const Company* company);
+
+    /**
+     * @brief Finds the best rated companies whose name starts with a prefix, ignoring case and accents.
+     *
+     * The companies are ordered by average rating, then by number of ratings, then by NIF.
+     *
+     * @param prefix The prefix.
+     * @param maxResults The capacity of the results array.
+     * @param results An array receiving the companies, best rated first.
+     * @return The number of companies written to the array.
+     */
+    int completeCompanyName(const char* prefix, int maxResults, Company* results[]);
+
+    /**
+     * @brief Frees the memory of the index.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freeNameCompletions();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUTOCOMPLETE_H */
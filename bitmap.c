@@ -0,0 +1,483 @@
+/**
+ * @file bitmap.c
+ * @brief source file for the compressed bitmaps of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "utilities.h"
+#include "bitmap.h"
+
+    static void freeContainer(BitmapContainer *container) {
+        free(container->values);
+        free(container->words);
+        container->values = NULL;
+        container->words = NULL;
+    }
+
+    /*
+     * Finds the container of a key. Returns its index, or -(insertion point) - 1 if there is none.
+     */
+    static int findContainer(const Bitmap *bitmap, uint16_t key) {
+        int low = 0;
+        int high = bitmap->count - 1;
+
+        while (low <= high) {
+            int middle = (low + high) / 2;
+            uint16_t middleKey = bitmap->containers[middle].key;
+
+            if (middleKey == key) {
+                return middle;
+            } else if (middleKey < key) {
+                low = middle + 1;
+            } else {
+                high = middle - 1;
+            }
+        }
+        return -low - 1;
+    }
+
+    static BitmapContainer *insertContainer(Bitmap *bitmap, int position, uint16_t key) {
+        if (bitmap->count == bitmap->capacity) {
+            int capacity = bitmap->capacity > 0 ? bitmap->capacity * 2 : 4;
+            BitmapContainer *containers = realloc(bitmap->containers, capacity * sizeof(BitmapContainer));
+            if (containers == NULL) {
+                printf("Memory allocation error.\n");
+                return NULL;
+            }
+            bitmap->containers = containers;
+            bitmap->capacity = capacity;
+        }
+
+        memmove(&bitmap->containers[position + 1], &bitmap->containers[position],
+                (bitmap->count - position) * sizeof(BitmapContainer));
+        bitmap->count++;
+
+        BitmapContainer *container = &bitmap->containers[position];
+        memset(container, 0, sizeof(BitmapContainer));
+        container->key = key;
+        return container;
+    }
+
+    static void removeContainer(Bitmap *bitmap, int position) {
+        freeContainer(&bitmap->containers[position]);
+        memmove(&bitmap->containers[position], &bitmap->containers[position + 1],
+                (bitmap->count - position - 1) * sizeof(BitmapContainer));
+        bitmap->count--;
+    }
+
+    /*
+     * Finds a low value in an array container. Returns its index, or -(insertion point) - 1.
+     */
+    static int findValue(const BitmapContainer *container, uint16_t low) {
+        int first = 0;
+        int last = container->cardinality - 1;
+
+        while (first <= last) {
+            int middle = (first + last) / 2;
+
+            if (container->values[middle] == low) {
+                return middle;
+            } else if (container->values[middle] < low) {
+                first = middle + 1;
+            } else {
+                last = middle - 1;
+            }
+        }
+        return -first - 1;
+    }
+
+    static int allocateArray(BitmapContainer *container, int capacity) {
+        container->isBitset = 0;
+        container->capacity = capacity > 0 ? capacity : 1;
+        container->values = malloc(container->capacity * sizeof(uint16_t));
+        if (container->values == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        return 1;
+    }
+
+    static void containerToWords(const BitmapContainer *container, uint64_t *words) {
+        if (container->isBitset) {
+            memcpy(words, container->words, BITMAP_WORDS * sizeof(uint64_t));
+            return;
+        }
+
+        memset(words, 0, BITMAP_WORDS * sizeof(uint64_t));
+        for (int i = 0; i < container->cardinality; i++) {
+            words[container->values[i] >> 6] |= 1ULL << (container->values[i] & 63);
+        }
+    }
+
+    /*
+     * Fills a container from a bitset, choosing the smaller representation.
+     * Returns 1 on success, 0 if memory could not be allocated.
+     */
+    static int containerFromWords(BitmapContainer *container, const uint64_t *words) {
+        int cardinality = 0;
+
+        for (int i = 0; i < BITMAP_WORDS; i++) {
+            cardinality += __builtin_popcountll(words[i]);
+        }
+
+        freeContainer(container);
+        container->cardinality = cardinality;
+
+        if (cardinality > BITMAP_ARRAY_MAX) {
+            container->isBitset = 1;
+            container->capacity = 0;
+            container->words = malloc(BITMAP_WORDS * sizeof(uint64_t));
+            if (container->words == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            memcpy(container->words, words, BITMAP_WORDS * sizeof(uint64_t));
+            return 1;
+        }
+
+        if (!allocateArray(container, cardinality)) {
+            return 0;
+        }
+
+        int n = 0;
+        for (int i = 0; i < BITMAP_WORDS; i++) {
+            for (uint64_t word = words[i]; word != 0; word &= word - 1) {
+                container->values[n++] = (uint16_t) (i * 64 + __builtin_ctzll(word));
+            }
+        }
+        return 1;
+    }
+
+    static int convertContainer(BitmapContainer *container) {
+        uint64_t *words = malloc(BITMAP_WORDS * sizeof(uint64_t));
+
+        if (words == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        containerToWords(container, words);
+        int ok = containerFromWords(container, words);
+        free(words);
+        return ok;
+    }
+
+    static int addToArray(BitmapContainer *container, uint16_t low) {
+        int position = findValue(container, low);
+
+        if (position >= 0) {
+            return 1;
+        }
+        position = -position - 1;
+
+        if (container->cardinality == container->capacity) {
+            int capacity = container->capacity > 0 ? container->capacity * 2 : 4;
+            uint16_t *values = realloc(container->values, capacity * sizeof(uint16_t));
+            if (values == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            container->values = values;
+            container->capacity = capacity;
+        }
+
+        memmove(&container->values[position + 1], &container->values[position],
+                (container->cardinality - position) * sizeof(uint16_t));
+        container->values[position] = low;
+        container->cardinality++;
+
+        return container->cardinality > BITMAP_ARRAY_MAX ? convertContainer(container) : 1;
+    }
+
+    int bitmapAdd(Bitmap *bitmap, int value) {
+        uint16_t key = (uint16_t) ((uint32_t) value >> 16);
+        uint16_t low = (uint16_t) value;
+        int position = findContainer(bitmap, key);
+        BitmapContainer *container;
+
+        if (position >= 0) {
+            container = &bitmap->containers[position];
+        } else {
+            container = insertContainer(bitmap, -position - 1, key);
+            if (container == NULL) {
+                return 0;
+            }
+        }
+
+        if (!container->isBitset) {
+            return addToArray(container, low);
+        }
+
+        uint64_t bit = 1ULL << (low & 63);
+        if (!(container->words[low >> 6] & bit)) {
+            container->words[low >> 6] |= bit;
+            container->cardinality++;
+        }
+        return 1;
+    }
+
+    void bitmapRemove(Bitmap *bitmap, int value) {
+        int position = findContainer(bitmap, (uint16_t) ((uint32_t) value >> 16));
+        uint16_t low = (uint16_t) value;
+
+        if (position < 0) {
+            return;
+        }
+
+        BitmapContainer *container = &bitmap->containers[position];
+
+        if (container->isBitset) {
+            uint64_t bit = 1ULL << (low & 63);
+            if (container->words[low >> 6] & bit) {
+                container->words[low >> 6] &= ~bit;
+                container->cardinality--;
+                if (container->cardinality <= BITMAP_BITSET_MIN) {
+                    convertContainer(container);
+                }
+            }
+        } else {
+            int index = findValue(container, low);
+            if (index >= 0) {
+                memmove(&container->values[index], &container->values[index + 1],
+                        (container->cardinality - index - 1) * sizeof(uint16_t));
+                container->cardinality--;
+            }
+        }
+
+        if (container->cardinality == 0) {
+            removeContainer(bitmap, position);
+        }
+    }
+
+    int bitmapContains(const Bitmap *bitmap, int value) {
+        int position = findContainer(bitmap, (uint16_t) ((uint32_t) value >> 16));
+        uint16_t low = (uint16_t) value;
+
+        if (value < 0 || position < 0) {
+            return 0;
+        }
+
+        const BitmapContainer *container = &bitmap->containers[position];
+        if (container->isBitset) {
+            return (container->words[low >> 6] >> (low & 63)) & 1;
+        }
+        return findValue(container, low) >= 0;
+    }
+
+    int bitmapCardinality(const Bitmap *bitmap) {
+        int cardinality = 0;
+
+        for (int i = 0; i < bitmap->count; i++) {
+            cardinality += bitmap->containers[i].cardinality;
+        }
+        return cardinality;
+    }
+
+    static int copyContainer(const BitmapContainer *source, BitmapContainer *container) {
+        container->cardinality = source->cardinality;
+
+        if (source->isBitset) {
+            container->isBitset = 1;
+            container->words = malloc(BITMAP_WORDS * sizeof(uint64_t));
+            if (container->words == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            memcpy(container->words, source->words, BITMAP_WORDS * sizeof(uint64_t));
+            return 1;
+        }
+
+        if (!allocateArray(container, source->cardinality)) {
+            return 0;
+        }
+        memcpy(container->values, source->values, source->cardinality * sizeof(uint16_t));
+        return 1;
+    }
+
+    /*
+     * Intersects or unites two array containers by merging their sorted values.
+     */
+    static int mergeArrays(const BitmapContainer *a, const BitmapContainer *b, BitmapContainer *container, int isUnion) {
+        int capacity = isUnion ? a->cardinality + b->cardinality :
+                a->cardinality < b->cardinality ? a->cardinality : b->cardinality;
+        int i = 0;
+        int j = 0;
+        int n = 0;
+
+        if (!allocateArray(container, capacity)) {
+            return 0;
+        }
+
+        // The values are written and the positions moved without branching on the comparison,
+        // which would be mispredicted about half the time.
+        while (i < a->cardinality && j < b->cardinality) {
+            uint16_t valueA = a->values[i];
+            uint16_t valueB = b->values[j];
+
+            container->values[n] = valueA < valueB ? valueA : valueB;
+            n += isUnion || valueA == valueB;
+            i += valueA <= valueB;
+            j += valueB <= valueA;
+        }
+        if (isUnion) {
+            memcpy(&container->values[n], &a->values[i], (a->cardinality - i) * sizeof(uint16_t));
+            n += a->cardinality - i;
+            memcpy(&container->values[n], &b->values[j], (b->cardinality - j) * sizeof(uint16_t));
+            n += b->cardinality - j;
+        }
+
+        container->cardinality = n;
+        return n > BITMAP_ARRAY_MAX ? convertContainer(container) : 1;
+    }
+
+    /*
+     * Intersects an array container with a bitset container by testing each value of the array.
+     */
+    static int probeArray(const BitmapContainer *array, const BitmapContainer *bitset, BitmapContainer *container) {
+        int n = 0;
+
+        if (!allocateArray(container, array->cardinality)) {
+            return 0;
+        }
+
+        for (int i = 0; i < array->cardinality; i++) {
+            uint16_t low = array->values[i];
+            if ((bitset->words[low >> 6] >> (low & 63)) & 1) {
+                container->values[n++] = low;
+            }
+        }
+
+        container->cardinality = n;
+        return 1;
+    }
+
+    /*
+     * Combines two bitmaps container by container. Containers present in only one of them are
+     * copied for a union and dropped for an intersection. Only two bitsets, or a bitset and an
+     * array being united, are combined as bitsets.
+     */
+    static int combineBitmaps(const Bitmap *a, const Bitmap *b, Bitmap *result, int isUnion) {
+        uint64_t *words = NULL;
+        uint64_t *other = NULL;
+        int i = 0;
+        int j = 0;
+        int ok = 1;
+
+        while (ok && (i < a->count || j < b->count)) {
+            const BitmapContainer *left = i < a->count ? &a->containers[i] : NULL;
+            const BitmapContainer *right = j < b->count ? &b->containers[j] : NULL;
+            const BitmapContainer *only = NULL;
+
+            if (right == NULL || (left != NULL && left->key < right->key)) {
+                i++;
+                only = left;
+            } else if (left == NULL || right->key < left->key) {
+                j++;
+                only = right;
+            } else {
+                i++;
+                j++;
+            }
+            if (only != NULL && !isUnion) {
+                continue;
+            }
+
+            BitmapContainer *container = insertContainer(result, result->count, only != NULL ? only->key : left->key);
+            if (container == NULL) {
+                ok = 0;
+            } else if (only != NULL) {
+                ok = copyContainer(only, container);
+            } else if (!left->isBitset && !right->isBitset) {
+                ok = mergeArrays(left, right, container, isUnion);
+            } else if (!isUnion && (!left->isBitset || !right->isBitset)) {
+                ok = left->isBitset ? probeArray(right, left, container) : probeArray(left, right, container);
+            } else {
+                if (words == NULL) {
+                    words = malloc(BITMAP_WORDS * sizeof(uint64_t));
+                    other = malloc(BITMAP_WORDS * sizeof(uint64_t));
+                    if (words == NULL || other == NULL) {
+                        printf("Memory allocation error.\n");
+                        removeContainer(result, result->count - 1);
+                        ok = 0;
+                        break;
+                    }
+                }
+
+                containerToWords(left, words);
+                containerToWords(right, other);
+                for (int w = 0; w < BITMAP_WORDS; w++) {
+                    words[w] = isUnion ? words[w] | other[w] : words[w] & other[w];
+                }
+                ok = containerFromWords(container, words);
+            }
+
+            if (ok && container->cardinality == 0) {
+                removeContainer(result, result->count - 1);
+            }
+        }
+
+        free(words);
+        free(other);
+        return ok;
+    }
+
+    int bitmapAnd(const Bitmap *a, const Bitmap *b, Bitmap *result) {
+        return combineBitmaps(a, b, result, 0);
+    }
+
+    int bitmapOr(const Bitmap *a, const Bitmap *b, Bitmap *result) {
+        return combineBitmaps(a, b, result, 1);
+    }
+
+    void bitmapIterate(const Bitmap *bitmap, BitmapIterator *iterator) {
+        iterator->bitmap = bitmap;
+        iterator->container = 0;
+        iterator->position = 0;
+    }
+
+    int bitmapNext(BitmapIterator *iterator, int *value) {
+        while (iterator->container < iterator->bitmap->count) {
+            const BitmapContainer *container = &iterator->bitmap->containers[iterator->container];
+            int high = (int) container->key << 16;
+
+            if (!container->isBitset) {
+                if (iterator->position < container->cardinality) {
+                    *value = high | container->values[iterator->position++];
+                    return 1;
+                }
+            } else {
+                while (iterator->position < BITMAP_WORDS * 64) {
+                    int w = iterator->position >> 6;
+                    uint64_t word = container->words[w] >> (iterator->position & 63);
+
+                    if (word != 0) {
+                        int bit = iterator->position + __builtin_ctzll(word);
+                        iterator->position = bit + 1;
+                        *value = high | bit;
+                        return 1;
+                    }
+                    iterator->position = (w + 1) * 64;
+                }
+            }
+
+            iterator->container++;
+            iterator->position = 0;
+        }
+        return 0;
+    }
+
+    void clearBitmap(Bitmap *bitmap) {
+        for (int i = 0; i < bitmap->count; i++) {
+            freeContainer(&bitmap->containers[i]);
+        }
+        bitmap->count = 0;
+    }
+
+    void freeBitmap(Bitmap *bitmap) {
+        clearBitmap(bitmap);
+        free(bitmap->containers);
+        memset(bitmap, 0, sizeof(Bitmap));
+    }
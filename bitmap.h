@@ -0,0 +1,167 @@
+/**
+ * @file bitmap.h
+ * @brief Header file for the compressed bitmaps of the Company Management System.
+ *
+ * A bitmap is a set of non-negative integers, such as table slots. Values are grouped by their
+ * high 16 bits into containers. A container with few values keeps them as a sorted array of their
+ * low 16 bits; once it holds more than BITMAP_ARRAY_MAX values it becomes a bitset of 65536 bits,
+ * which is smaller from that point on. A bitset only goes back to an array once it is down to
+ * BITMAP_BITSET_MIN values, so adding and removing around the limit does not convert the
+ * container each time. Intersections and unions go one container at a time: two arrays are
+ * merged, an array is intersected with a bitset by testing each of its values, and two bitsets
+ * are combined 64-bit word by word.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Largest number of values kept as an array in one container.
+     */
+    #define BITMAP_ARRAY_MAX 4096
+
+    /**
+     * @brief Number of values at which a bitset container removed from goes back to an array.
+     */
+    #define BITMAP_BITSET_MIN (BITMAP_ARRAY_MAX / 2)
+
+    /**
+     * @brief Number of 64-bit words of a bitset container.
+     */
+    #define BITMAP_WORDS 1024
+
+    /**
+     * @brief The values of a bitmap sharing the same high 16 bits.
+     */
+    typedef struct {
+        uint16_t key;        // high 16 bits of the values
+        uint16_t isBitset;
+        int cardinality;
+        int capacity;        // values allocated in the array
+        uint16_t* values;    // array container: the low 16 bits, sorted
+        uint64_t* words;     // bitset container: BITMAP_WORDS words
+    } BitmapContainer;
+
+    /**
+     * @brief Structure representing a compressed bitmap.
+     */
+    typedef struct {
+        BitmapContainer* containers;  // sorted by key
+        int count;
+        int capacity;
+    } Bitmap;
+
+    /**
+     * @brief Position of an iteration over a bitmap, in increasing order of the values.
+     */
+    typedef struct {
+        const Bitmap* bitmap;
+        int container;
+        int position;  // index in the array, or bit in the bitset
+    } BitmapIterator;
+
+    /**
+     * @brief Adds a value to a bitmap.
+     *
+     * @param bitmap The bitmap.
+     * @param value The value, not negative.
+     * @return 1 on success, 0 if memory could not be allocated.
+     */
+    int bitmapAdd(Bitmap* bitmap, int value);
+
+    /**
+     * @brief Removes a value from a bitmap.
+     *
+     * @param bitmap The bitmap.
+     * @param value The value.
+     * @return void - This function does not return a value.
+     */
+    void bitmapRemove(Bitmap* bitmap, int value);
+
+    /**
+     * @brief Checks whether a bitmap holds a value.
+     *
+     * @param bitmap The bitmap.
+     * @param value The value.
+     * @return 1 if the value is in the bitmap, 0 otherwise.
+     */
+    int bitmapContains(const Bitmap* bitmap, int value);
+
+    /**
+     * @brief Counts the values of a bitmap.
+     *
+     * @param bitmap The bitmap.
+     * @return The number of values.
+     */
+    int bitmapCardinality(const Bitmap* bitmap);
+
+    /**
+     * @brief Computes the intersection of two bitmaps.
+     *
+     * @param a The first bitmap.
+     * @param b The second bitmap.
+     * @param result An empty bitmap receiving the values present in both.
+     * @return 1 on success, 0 if memory could not be allocated.
+     */
+    int bitmapAnd(const Bitmap* a, const Bitmap* b, Bitmap* result);
+
+    /**
+     * @brief Computes the union of two bitmaps.
+     *
+     * @param a The first bitmap.
+     * @param b The second bitmap.
+     * @param result An empty bitmap receiving the values present in either.
+     * @return 1 on success, 0 if memory could not be allocated.
+     */
+    int bitmapOr(const Bitmap* a, const Bitmap* b, Bitmap* result);
+
+    /**
+     * @brief Starts an iteration over a bitmap.
+     *
+     * The bitmap must not change until the iteration ends.
+     *
+     * @param bitmap The bitmap.
+     * @param iterator The iterator.
+     * @return void - This function does not return a value.
+     */
+    void bitmapIterate(const Bitmap* bitmap, BitmapIterator* iterator);
+
+    /**
+     * @brief Gets the next value of an iteration.
+     *
+     * @param iterator The iterator.
+     * @param value Receives the value.
+     * @return 1 if there was another value, 0 at the end of the bitmap.
+     */
+    int bitmapNext(BitmapIterator* iterator, int* value);
+
+    /**
+     * @brief Removes every value from a bitmap.
+     *
+     * @param bitmap The bitmap.
+     * @return void - This function does not return a value.
+     */
+    void clearBitmap(Bitmap* bitmap);
+
+    /**
+     * @brief Frees the memory of a bitmap.
+     *
+     * @param bitmap The bitmap.
+     * @return void - This function does not return a value.
+     */
+    void freeBitmap(Bitmap* bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BITMAP_H */
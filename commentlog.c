@@ -0,0 +1,609 @@
+/**
+ * @file commentlog.c
+ * @brief source file for the comment log of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "commentlog.h"
+#include "textscan.h"
+#include "companytable.h"
+
+/**
+ * @brief The comment index, kept in memory once read.
+ */
+static CommentIndexEntry *commentIndex = NULL;
+static int numIndexEntries = 0;
+static int indexCapacity = 0;
+static int indexLoaded = 0;
+
+/**
+ * @brief Next entry of the same company for each entry of the index, -1 for the last one.
+ */
+static int *nextEntry = NULL;
+
+/**
+ * @brief The entries of one company: its comments are read by following nextEntry from first.
+ */
+typedef struct {
+    int32_t nif;
+    int first;  // -1 for an empty bucket
+    int last;
+    int count;
+} CommentChain;
+
+/**
+ * @brief Hash from NIF to the chain of entries of the company, with linear probing.
+ */
+static CommentChain *chains = NULL;
+static int chainCapacity = 0;  // a power of two
+static int numChains = 0;
+
+/**
+ * @brief Bytes of the log covered by the index.
+ */
+static uint64_t indexedLogSize = sizeof(CommentFileHeader);
+
+    static int writeAt(int fd, const void *buffer, size_t length, off_t offset) {
+        const char *bytes = buffer;
+
+        while (length > 0) {
+            ssize_t written = pwrite(fd, bytes, length, offset);
+            if (written <= 0) {
+                return 0;
+            }
+            bytes += written;
+            length -= written;
+            offset += written;
+        }
+        return 1;
+    }
+
+    static int readAt(int fd, void *buffer, size_t length, off_t offset) {
+        return pread(fd, buffer, length, offset) == (ssize_t) length;
+    }
+
+    static CommentFileHeader makeCommentFileHeader(uint32_t magic, uint64_t logSize) {
+        CommentFileHeader header = {magic, COMMENT_LOG_VERSION, logSize};
+        return header;
+    }
+
+    static unsigned int chainHash(int32_t nif, int capacity) {
+        return ((unsigned int) nif * 2654435761u) & (capacity - 1);
+    }
+
+    static CommentChain *findChain(CommentChain *table, int capacity, int32_t nif) {
+        unsigned int i = chainHash(nif, capacity);
+
+        while (table[i].first >= 0 && table[i].nif != nif) {
+            i = (i + 1) & (capacity - 1);
+        }
+        return &table[i];
+    }
+
+    static int growChains() {
+        int capacity = chainCapacity > 0 ? chainCapacity * 2 : 64;
+        CommentChain *grown = malloc(capacity * sizeof(CommentChain));
+
+        if (grown == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        for (int i = 0; i < capacity; i++) {
+            grown[i].first = -1;
+        }
+        for (int i = 0; i < chainCapacity; i++) {
+            if (chains[i].first >= 0) {
+                *findChain(grown, capacity, chains[i].nif) = chains[i];
+            }
+        }
+
+        free(chains);
+        chains = grown;
+        chainCapacity = capacity;
+        return 1;
+    }
+
+    /*
+     * Adds an entry at the end of the chain of its company.
+     */
+    static int linkIndexEntry(int entry) {
+        if (2 * (numChains + 1) > chainCapacity && !growChains()) {
+            return 0;
+        }
+
+        CommentChain *chain = findChain(chains, chainCapacity, commentIndex[entry].nif);
+        if (chain->first < 0) {
+            chain->nif = commentIndex[entry].nif;
+            chain->first = entry;
+            chain->count = 0;
+            numChains++;
+        } else {
+            nextEntry[chain->last] = entry;
+        }
+        chain->last = entry;
+        chain->count++;
+        nextEntry[entry] = -1;
+        return 1;
+    }
+
+    static int pushIndexEntry(int32_t nif, uint32_t length, uint64_t offset) {
+        if (numIndexEntries == indexCapacity) {
+            int capacity = indexCapacity == 0 ? INITIAL_BUFFER_SIZE : indexCapacity * 2;
+            CommentIndexEntry *grown = realloc(commentIndex, capacity * sizeof(CommentIndexEntry));
+            int *grownNext = grown != NULL ? realloc(nextEntry, capacity * sizeof(int)) : NULL;
+
+            if (grown != NULL) {
+                commentIndex = grown;
+            }
+            if (grownNext == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            nextEntry = grownNext;
+            indexCapacity = capacity;
+        }
+
+        commentIndex[numIndexEntries].nif = nif;
+        commentIndex[numIndexEntries].length = length;
+        commentIndex[numIndexEntries].offset = offset;
+        if (!linkIndexEntry(numIndexEntries)) {
+            return 0;
+        }
+        numIndexEntries++;
+        return 1;
+    }
+
+    /*
+     * Writes the index entries from firstEntry onwards, followed by the header recording
+     * how much of the log they cover.
+     */
+    static int writeIndexEntries(int firstEntry) {
+        int fd = open(COMMENT_INDEX_FILE, O_RDWR | O_CREAT, 0644);
+
+        if (fd < 0) {
+            return 0;
+        }
+
+        CommentFileHeader header = makeCommentFileHeader(COMMENT_INDEX_MAGIC, indexedLogSize);
+        off_t offset = sizeof(CommentFileHeader) + (off_t) firstEntry * sizeof(CommentIndexEntry);
+        int ok = writeAt(fd, commentIndex + firstEntry, (numIndexEntries - firstEntry) * sizeof(CommentIndexEntry), offset) &&
+                writeAt(fd, &header, sizeof(header), 0);
+
+        close(fd);
+        return ok;
+    }
+
+    /*
+     * Indexes the records appended to the log after indexedLogSize, for instance when the
+     * index is missing or the program stopped between writing the log and the index.
+     */
+    static void catchUpCommentIndex() {
+        int fd = open(COMMENT_LOG_FILE, O_RDONLY);
+        struct stat st;
+        int firstEntry = numIndexEntries;
+
+        if (fd < 0) {
+            return;
+        }
+
+        if (fstat(fd, &st) == 0) {
+            uint64_t offset = indexedLogSize;
+            CommentRecord record;
+
+            while (offset + sizeof(CommentRecord) <= (uint64_t) st.st_size &&
+                    readAt(fd, &record, sizeof(record), offset)) {
+                uint32_t length = sizeof(CommentRecord) + record.usernameLength + record.titleLength + record.textLength;
+
+                if (offset + length > (uint64_t) st.st_size || !pushIndexEntry(record.nif, length, offset)) {
+                    break;
+                }
+                offset += length;
+            }
+            indexedLogSize = offset;
+        }
+        close(fd);
+
+        if (numIndexEntries > firstEntry) {
+            writeIndexEntries(firstEntry);
+        }
+    }
+
+    static void ensureCommentIndex() {
+        if (indexLoaded) {
+            return;
+        }
+        indexLoaded = 1;
+
+        int fd = open(COMMENT_INDEX_FILE, O_RDONLY);
+        struct stat st;
+        CommentFileHeader header;
+
+        if (fd >= 0 && fstat(fd, &st) == 0 && readAt(fd, &header, sizeof(header), 0) &&
+                header.magic == COMMENT_INDEX_MAGIC && header.version == COMMENT_LOG_VERSION) {
+            int count = (st.st_size - sizeof(CommentFileHeader)) / sizeof(CommentIndexEntry);
+            CommentIndexEntry *entries = malloc((count + 1) * sizeof(CommentIndexEntry));
+            int *next = malloc((count + 1) * sizeof(int));
+
+            if (entries != NULL && next != NULL &&
+                    readAt(fd, entries, count * sizeof(CommentIndexEntry), sizeof(CommentFileHeader))) {
+                commentIndex = entries;
+                nextEntry = next;
+                numIndexEntries = count;
+                indexCapacity = count + 1;
+                indexedLogSize = header.logSize < sizeof(CommentFileHeader) ? sizeof(CommentFileHeader) : header.logSize;
+
+                // Drop entries written after the header was last updated; they are indexed again.
+                while (numIndexEntries > 0 && commentIndex[numIndexEntries - 1].offset >= indexedLogSize) {
+                    numIndexEntries--;
+                }
+
+                // The chains are not stored; linking the entries costs one pass over the index.
+                for (int i = 0; i < numIndexEntries; i++) {
+                    if (!linkIndexEntry(i)) {
+                        numIndexEntries = i;
+                        indexedLogSize = commentIndex[i].offset;
+                        break;
+                    }
+                }
+            } else {
+                free(entries);
+                free(next);
+            }
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+
+        catchUpCommentIndex();
+    }
+
+    static void copyCommentField(char *dest, size_t size, const char *value, size_t length) {
+        if (length > size - 1) {
+            length = size - 1;
+        }
+        memcpy(dest, value, length);
+        dest[length] = '\0';
+    }
+
+    int appendCommentToLog(int nif, const Comment *comment) {
+        ensureCommentIndex();
+
+        CommentRecord record = {nif,
+            strnlen(comment->username, sizeof(comment->username)),
+            strnlen(comment->title, sizeof(comment->title)),
+            strnlen(comment->text, sizeof(comment->text)), 0};
+        uint32_t length = sizeof(record) + record.usernameLength + record.titleLength + record.textLength;
+        char buffer[sizeof(CommentRecord) + sizeof(Comment)];
+
+        memcpy(buffer, &record, sizeof(record));
+        memcpy(buffer + sizeof(record), comment->username, record.usernameLength);
+        memcpy(buffer + sizeof(record) + record.usernameLength, comment->title, record.titleLength);
+        memcpy(buffer + sizeof(record) + record.usernameLength + record.titleLength, comment->text, record.textLength);
+
+        int fd = open(COMMENT_LOG_FILE, O_RDWR | O_CREAT, 0644);
+        struct stat st;
+
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            printf("Error opening file for writing.\n");
+            if (fd >= 0) {
+                close(fd);
+            }
+            return 0;
+        }
+
+        int ok = 1;
+        if (st.st_size == 0) {
+            CommentFileHeader header = makeCommentFileHeader(COMMENT_LOG_MAGIC, 0);
+            ok = writeAt(fd, &header, sizeof(header), 0);
+            st.st_size = sizeof(header);
+        }
+
+        uint64_t offset = st.st_size;
+        ok = ok && writeAt(fd, buffer, length, offset);
+        close(fd);
+
+        if (!ok) {
+            printf("Error writing %s.\n", COMMENT_LOG_FILE);
+            return 0;
+        }
+
+        // Records written behind the index's back (if any) are picked up first.
+        if (offset != indexedLogSize) {
+            catchUpCommentIndex();
+            return 1;
+        }
+
+        if (pushIndexEntry(nif, length, offset)) {
+            indexedLogSize = offset + length;
+            writeIndexEntries(numIndexEntries - 1);
+        }
+        return 1;
+    }
+
+    static void decodeComment(const char *record, Comment *comment) {
+        // Records follow each other in the log without padding, so the header is copied out
+        // rather than read in place.
+        CommentRecord header;
+        const char *fields = record + sizeof(CommentRecord);
+
+        memcpy(&header, record, sizeof(header));
+        copyCommentField(comment->username, sizeof(comment->username), fields, header.usernameLength);
+        fields += header.usernameLength;
+        copyCommentField(comment->title, sizeof(comment->title), fields, header.titleLength);
+        fields += header.titleLength;
+        copyCommentField(comment->text, sizeof(comment->text), fields, header.textLength);
+    }
+
+    int loadCompanyComments(int nif, Comment comments[], int maxComments) {
+        ensureCommentIndex();
+
+        int fd = open(COMMENT_LOG_FILE, O_RDONLY);
+        int count = 0;
+        char buffer[sizeof(CommentRecord) + sizeof(Comment)];
+
+        if (fd < 0) {
+            return 0;
+        }
+
+        // Only the entries of this company are visited, through its chain.
+        int first = chainCapacity > 0 ? findChain(chains, chainCapacity, nif)->first : -1;
+        for (int i = first; i >= 0 && count < maxComments; i = nextEntry[i]) {
+            const CommentIndexEntry *entry = &commentIndex[i];
+
+            if (entry->length > sizeof(buffer)) {
+                continue;
+            }
+            if (readAt(fd, buffer, entry->length, entry->offset)) {
+                decodeComment(buffer, &comments[count++]);
+            }
+        }
+
+        close(fd);
+        return count;
+    }
+
+    int countLoggedComments() {
+        ensureCommentIndex();
+        return numIndexEntries;
+    }
+
+    int loadLoggedComments(int first, int count, int nifs[], Comment comments[]) {
+        ensureCommentIndex();
+
+        int fd = open(COMMENT_LOG_FILE, O_RDONLY);
+        struct stat st;
+        int loaded = 0;
+
+        if (fd < 0) {
+            return 0;
+        }
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return 0;
+        }
+
+        // The records are next to each other in the log, so it is mapped instead of read one by one.
+        char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) {
+            printf("Error mapping %s.\n", COMMENT_LOG_FILE);
+            return 0;
+        }
+
+        for (int i = first; i < first + count && i < numIndexEntries; i++) {
+            const CommentIndexEntry *entry = &commentIndex[i];
+
+            if (entry->offset + entry->length > (uint64_t) st.st_size || entry->length > sizeof(CommentRecord) + sizeof(Comment)) {
+                break;
+            }
+            nifs[loaded] = entry->nif;
+            decodeComment(map + entry->offset, &comments[loaded]);
+            loaded++;
+        }
+
+        munmap(map, st.st_size);
+        return loaded;
+    }
+
+    int loadCommentsByNumber(const int numbers[], int count, int nifs[], Comment comments[]) {
+        ensureCommentIndex();
+
+        int fd = open(COMMENT_LOG_FILE, O_RDONLY);
+        int loaded = 0;
+        char buffer[sizeof(CommentRecord) + sizeof(Comment)];
+
+        for (int i = 0; i < count; i++) {
+            nifs[i] = -1;
+        }
+        if (fd < 0) {
+            return 0;
+        }
+
+        for (int i = 0; i < count; i++) {
+            if (numbers[i] < 0 || numbers[i] >= numIndexEntries) {
+                continue;
+            }
+
+            const CommentIndexEntry *entry = &commentIndex[numbers[i]];
+            if (entry->length <= sizeof(buffer) && readAt(fd, buffer, entry->length, entry->offset)) {
+                nifs[i] = entry->nif;
+                decodeComment(buffer, &comments[i]);
+                loaded++;
+            }
+        }
+
+        close(fd);
+        return loaded;
+    }
+
+    static int findCompanyByName(const CompanyTable *companies, TextToken name) {
+        for (int i = 0; i < companies->count; i++) {
+            if (tokenEquals(name, companyAt(companies, i)->name)) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    static int isSameComment(const Comment *a, const Comment *b) {
+        return strcmp(a->username, b->username) == 0 && strcmp(a->title, b->title) == 0 &&
+                strcmp(a->text, b->text) == 0;
+    }
+
+    static unsigned int hashText(unsigned int hash, const char *text) {
+        for (const unsigned char *p = (const unsigned char *) text; *p != '\0'; p++) {
+            hash = (hash ^ *p) * 16777619u;
+        }
+        return (hash ^ 0xffu) * 16777619u;
+    }
+
+    static unsigned int commentHash(int owner, const Comment *comment) {
+        unsigned int hash = (2166136261u ^ (unsigned int) owner) * 16777619u;
+        return hashText(hashText(hashText(hash, comment->username), comment->title), comment->text);
+    }
+
+    /*
+     * Hash set of the comments kept so far, by owner and content: each bucket holds the
+     * position of a comment in seen plus one, 0 if it is empty.
+     */
+    static int growSeenBuckets(int **buckets, int *numBuckets, const Comment *seen, const int *seenOwners, int count) {
+        int capacity = *numBuckets > 0 ? *numBuckets * 2 : 64;
+        int *grown = calloc(capacity, sizeof(int));
+
+        if (grown == NULL) {
+            return 0;
+        }
+        for (int i = 0; i < count; i++) {
+            unsigned int b = commentHash(seenOwners[i], &seen[i]) & (capacity - 1);
+            while (grown[b] != 0) {
+                b = (b + 1) & (capacity - 1);
+            }
+            grown[b] = i + 1;
+        }
+
+        free(*buckets);
+        *buckets = grown;
+        *numBuckets = capacity;
+        return 1;
+    }
+
+    /*
+     * Builds the log from comments.txt. The legacy file was rewritten in full every time a
+     * comment was added, so repeated copies of the same comment are only kept once.
+     */
+    static void convertLegacyComments(const CompanyTable *companies) {
+        TextScanner scanner;
+
+        if (!openTextScanner(&scanner, COMMENT_LEGACY_FILE)) {
+            return;
+        }
+
+        int capacity = INITIAL_BUFFER_SIZE;
+        int count = 0;
+        Comment *seen = malloc(capacity * sizeof(Comment));
+        int *seenOwners = malloc(capacity * sizeof(int));
+        int *buckets = NULL;
+        int numBuckets = 0;
+        int owner = -1;
+        Comment comment;
+        TextToken value;
+
+        memset(&comment, 0, sizeof(comment));
+
+        while (seen != NULL && seenOwners != NULL && nextLine(&scanner, NULL)) {
+            if (scanLiteral(&scanner, "Company: ")) {
+                scanRest(&scanner, &value);
+                owner = findCompanyByName(companies, value);
+            } else if (scanLiteral(&scanner, "Username: ")) {
+                scanRest(&scanner, &value);
+                copyToken(comment.username, sizeof(comment.username), value);
+            } else if (scanLiteral(&scanner, "Title: ")) {
+                scanRest(&scanner, &value);
+                copyToken(comment.title, sizeof(comment.title), value);
+            } else if (!scanLiteral(&scanner, "Text: ")) {
+                if (!atLineEnd(&scanner) && !scanLiteral(&scanner, "---")) {
+                    reportScanError(&scanner, scanner.cursor, "expected Company, Username, Title or Text");
+                }
+            } else {
+                scanRest(&scanner, &value);
+                copyToken(comment.text, sizeof(comment.text), value);
+
+                if (owner < 0) {
+                    continue;
+                }
+                if (2 * (count + 1) > numBuckets && !growSeenBuckets(&buckets, &numBuckets, seen, seenOwners, count)) {
+                    printf("Memory allocation error.\n");
+                    break;
+                }
+
+                // Only the comments with the same hash are compared.
+                unsigned int b = commentHash(owner, &comment) & (numBuckets - 1);
+                int duplicate = 0;
+                while (buckets[b] != 0 && !duplicate) {
+                    int i = buckets[b] - 1;
+                    duplicate = seenOwners[i] == owner && isSameComment(&seen[i], &comment);
+                    b = (b + 1) & (numBuckets - 1);
+                }
+                if (duplicate) {
+                    continue;
+                }
+
+                if (count == capacity) {
+                    Comment *grownSeen = realloc(seen, capacity * 2 * sizeof(Comment));
+                    if (grownSeen != NULL) {
+                        seen = grownSeen;
+                    }
+                    int *grownOwners = realloc(seenOwners, capacity * 2 * sizeof(int));
+                    if (grownOwners != NULL) {
+                        seenOwners = grownOwners;
+                    }
+                    if (grownSeen == NULL || grownOwners == NULL) {
+                        printf("Memory allocation error.\n");
+                        break;
+                    }
+                    capacity *= 2;
+                }
+                seen[count] = comment;
+                seenOwners[count] = owner;
+                buckets[b] = ++count;
+                appendCommentToLog(companyAt(companies, owner)->nif, &comment);
+            }
+        }
+
+        free(seen);
+        free(seenOwners);
+        free(buckets);
+        closeTextScanner(&scanner);
+    }
+
+    int countCommentsInLog(CompanyTable *companies) {
+        for (int i = 0; i < companies->count; i++) {
+            companyAt(companies, i)->numComments = 0;
+        }
+
+        if (access(COMMENT_LOG_FILE, F_OK) != 0) {
+            convertLegacyComments(companies);
+        }
+        ensureCommentIndex();
+
+        int counted = 0;
+
+        // Only the chains are read; the text of the comments stays in the log until it is needed.
+        for (int i = 0; i < chainCapacity; i++) {
+            Company *company = chains[i].first >= 0 ? findCompanyByNif(companies, chains[i].nif) : NULL;
+
+            if (company != NULL) {
+                company->numComments = chains[i].count;
+                counted += chains[i].count;
+            }
+        }
+
+        return counted;
+    }
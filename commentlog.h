@@ -0,0 +1,150 @@
+/**
+ * @file commentlog.h
+ * @brief Header file for the comment log of the Company Management System.
+ *
+ * Comments are kept in comments.log, where adding a comment appends exactly one record.
+ * The sidecar file comments.idx holds one small entry per comment with the NIF of the company
+ * and the offset of the record in the log, so the comments of one company can be read with
+ * one seek per comment instead of reading the whole log. Once the index is read, its entries
+ * are chained by company through a hash from NIF to the first entry, so reading the comments
+ * of a company only visits its own entries.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef COMMENTLOG_H
+#define COMMENTLOG_H
+
+#include <stdint.h>
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Name of the comment log.
+     */
+    #define COMMENT_LOG_FILE "comments.log"
+
+    /**
+     * @brief Name of the index of the comment log.
+     */
+    #define COMMENT_INDEX_FILE "comments.idx"
+
+    /**
+     * @brief Name of the legacy comments file converted into the log.
+     */
+    #define COMMENT_LEGACY_FILE "comments.txt"
+
+    /**
+     * @brief Magic number at the start of the comment log ("CL01").
+     */
+    #define COMMENT_LOG_MAGIC 0x31304c43u
+
+    /**
+     * @brief Magic number at the start of the comment index ("CI01").
+     */
+    #define COMMENT_INDEX_MAGIC 0x31304943u
+
+    /**
+     * @brief Current version of the comment log and index layout.
+     */
+    #define COMMENT_LOG_VERSION 1
+
+    /**
+     * @brief Header at the start of the comment log and of the index.
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t logSize;  // in the index: bytes of the log already indexed
+    } CommentFileHeader;
+
+    /**
+     * @brief Header of one comment in the log, followed by the text of its fields.
+     */
+    typedef struct {
+        int32_t nif;
+        uint16_t usernameLength;
+        uint16_t titleLength;
+        uint16_t textLength;
+        uint16_t reserved;
+    } CommentRecord;
+
+    /**
+     * @brief Entry of the comment index.
+     */
+    typedef struct {
+        int32_t nif;
+        uint32_t length;  // size of the record in the log, header included
+        uint64_t offset;  // position of the record in the log
+    } CommentIndexEntry;
+
+    /**
+     * @brief Appends one comment to the comment log and to its index.
+     *
+     * @param nif The NIF of the company commented on.
+     * @param comment The comment.
+     * @return 1 on success, 0 on failure.
+     */
+    int appendCommentToLog(int nif, const Comment* comment);
+
+    /**
+     * @brief Reads the comments of one company, using the index to seek to each of them.
+     *
+     * @param nif The NIF of the company.
+     * @param comments An array receiving the comments, oldest first.
+     * @param maxComments The capacity of the array.
+     * @return The number of comments read.
+     */
+    int loadCompanyComments(int nif, Comment comments[], int maxComments);
+
+    /**
+     * @brief Gets the number of comments in the log.
+     *
+     * Comments are numbered from 0 in the order they were added to the log.
+     *
+     * @return The number of comments.
+     */
+    int countLoggedComments();
+
+    /**
+     * @brief Reads consecutive comments of the log, whatever their company.
+     *
+     * @param first The number of the first comment to read.
+     * @param count The number of comments to read.
+     * @param nifs An array receiving the NIF of the company of each comment.
+     * @param comments An array receiving the comments.
+     * @return The number of comments read.
+     */
+    int loadLoggedComments(int first, int count, int nifs[], Comment comments[]);
+
+    /**
+     * @brief Reads comments of the log by their numbers, using the index to seek to each of them.
+     *
+     * @param numbers The numbers of the comments to read.
+     * @param count The number of comments to read.
+     * @param nifs An array receiving the NIF of the company of each comment, or -1 if it could not be read.
+     * @param comments An array receiving the comments, in the order of their numbers.
+     * @return The number of comments read.
+     */
+    int loadCommentsByNumber(const int numbers[], int count, int nifs[], Comment comments[]);
+
+    /**
+     * @brief Counts the comments of every company of the table, using only the index.
+     *
+     * The comments themselves stay in the log and are read with loadCompanyComments when
+     * they are needed. If there is no log yet, the legacy comments.txt file is converted first.
+     *
+     * @param companies The company table.
+     * @return The number of comments counted.
+     */
+    int countCommentsInLog(CompanyTable* companies);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMENTLOG_H */
@@ -0,0 +1,357 @@
+/**
+ * @file commentsearch.c
+ * @brief source file for the full-text search over the comments of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <ctype.h>
+#include <math.h>
+#include "commentsearch.h"
+#include "commentlog.h"
+#include "symbols.h"
+
+/**
+ * @brief Number of comments read from the log at a time while indexing.
+ */
+#define INDEX_BATCH_SIZE 256
+
+/**
+ * @brief Longest word kept in the index; longer words are truncated.
+ */
+#define MAX_WORD_LENGTH 50
+
+/**
+ * @brief The words of the comments, and the comments containing each of them, by word id.
+ */
+static SymbolTable words;
+static CommentPostingList *wordPostings = NULL;
+static int postingsCapacity = 0;
+
+/**
+ * @brief Length in words and NIF of the company of each indexed comment, by number of the comment in the log.
+ */
+static int *commentLengths = NULL;
+static int *commentNifs = NULL;
+
+/**
+ * @brief Score of each comment during a search, by number of the comment; all zero between searches.
+ */
+static double *commentScores = NULL;
+static int numIndexedComments = 0;
+static int lengthsCapacity = 0;
+static long long totalLength = 0;
+static int indexBuilt = 0;
+
+    /*
+     * Reads the next word from the text, lowercased. Letters and digits make up words; bytes
+     * outside ASCII are kept as they are so accented words are not split.
+     */
+    static int nextWord(const char **cursor, char word[MAX_WORD_LENGTH]) {
+        const unsigned char *p = (const unsigned char *) *cursor;
+        int length = 0;
+
+        while (*p != '\0' && !isalnum(*p) && *p < 128) {
+            p++;
+        }
+        while (*p != '\0' && (isalnum(*p) || *p >= 128)) {
+            if (length < MAX_WORD_LENGTH - 1) {
+                word[length++] = (char) tolower(*p);
+            }
+            p++;
+        }
+
+        word[length] = '\0';
+        *cursor = (const char *) p;
+        return length;
+    }
+
+    static int addCommentPosting(int wordId, int comment, int frequency) {
+        if (wordId >= postingsCapacity) {
+            int capacity = postingsCapacity > 0 ? postingsCapacity : INITIAL_BUFFER_SIZE;
+            while (capacity <= wordId) {
+                capacity *= 2;
+            }
+
+            CommentPostingList *grown = realloc(wordPostings, capacity * sizeof(CommentPostingList));
+            if (grown == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            memset(grown + postingsCapacity, 0, (capacity - postingsCapacity) * sizeof(CommentPostingList));
+            wordPostings = grown;
+            postingsCapacity = capacity;
+        }
+
+        CommentPostingList *list = &wordPostings[wordId];
+        if (list->count == list->capacity) {
+            int capacity = list->capacity > 0 ? list->capacity * 2 : 4;
+            CommentPosting *grown = realloc(list->postings, capacity * sizeof(CommentPosting));
+
+            if (grown == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            list->postings = grown;
+            list->capacity = capacity;
+        }
+
+        list->postings[list->count].comment = comment;
+        list->postings[list->count].frequency = frequency;
+        list->count++;
+        return 1;
+    }
+
+    static int compareInts(const void *a, const void *b) {
+        int x = *(const int *) a;
+        int y = *(const int *) b;
+        return (x > y) - (x < y);
+    }
+
+    /*
+     * Splits a text into word ids, interning new words when intern is set and skipping
+     * unknown ones otherwise. Returns the number of ids written.
+     */
+    static int collectWords(const char *text, int intern, int ids[], int maxIds) {
+        char word[MAX_WORD_LENGTH];
+        int count = 0;
+
+        while (count < maxIds && nextWord(&text, word) > 0) {
+            int id = intern ? internSymbol(&words, word) : findSymbol(&words, word);
+            if (id >= 0) {
+                ids[count++] = id;
+            }
+        }
+        return count;
+    }
+
+    static int indexComment(int number, int nif, const Comment *comment) {
+        // A comment holds at most one word per two bytes of its title and text.
+        int ids[(sizeof(comment->title) + sizeof(comment->text)) / 2];
+        int count = collectWords(comment->title, 1, ids, sizeof(ids) / sizeof(ids[0]));
+
+        count += collectWords(comment->text, 1, ids + count, sizeof(ids) / sizeof(ids[0]) - count);
+
+        if (number >= lengthsCapacity) {
+            int capacity = lengthsCapacity > 0 ? lengthsCapacity * 2 : INITIAL_BUFFER_SIZE;
+            int *lengths = realloc(commentLengths, capacity * sizeof(int));
+            int *nifs = lengths != NULL ? realloc(commentNifs, capacity * sizeof(int)) : NULL;
+            double *scores = nifs != NULL ? realloc(commentScores, capacity * sizeof(double)) : NULL;
+
+            if (lengths != NULL) {
+                commentLengths = lengths;
+            }
+            if (nifs != NULL) {
+                commentNifs = nifs;
+            }
+            if (scores == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            memset(scores + lengthsCapacity, 0, (capacity - lengthsCapacity) * sizeof(double));
+            commentScores = scores;
+            lengthsCapacity = capacity;
+        }
+
+        // Sorting the ids groups the repetitions of each word, which gives its frequency.
+        qsort(ids, count, sizeof(int), compareInts);
+        for (int i = 0; i < count;) {
+            int j = i;
+            while (j < count && ids[j] == ids[i]) {
+                j++;
+            }
+            if (!addCommentPosting(ids[i], number, j - i)) {
+                return 0;
+            }
+            i = j;
+        }
+
+        commentLengths[number] = count;
+        commentNifs[number] = nif;
+        totalLength += count;
+        return 1;
+    }
+
+    /*
+     * Indexes the comments of the log after the last one indexed.
+     */
+    static void catchUpCommentSearchIndex() {
+        int total = countLoggedComments();
+        int nifs[INDEX_BATCH_SIZE];
+        Comment *batch;
+
+        if (numIndexedComments >= total) {
+            return;
+        }
+
+        batch = malloc(INDEX_BATCH_SIZE * sizeof(Comment));
+        if (batch == NULL) {
+            printf("Memory allocation error.\n");
+            return;
+        }
+
+        while (numIndexedComments < total) {
+            int wanted = total - numIndexedComments < INDEX_BATCH_SIZE ? total - numIndexedComments : INDEX_BATCH_SIZE;
+            int loaded = loadLoggedComments(numIndexedComments, wanted, nifs, batch);
+
+            if (loaded == 0) {
+                break;
+            }
+            for (int i = 0; i < loaded; i++) {
+                if (!indexComment(numIndexedComments, nifs[i], &batch[i])) {
+                    free(batch);
+                    return;
+                }
+                numIndexedComments++;
+            }
+        }
+        free(batch);
+    }
+
+    static int compareMatchesByScore(const void *a, const void *b) {
+        const CommentMatch *x = a;
+        const CommentMatch *y = b;
+
+        if (x->score != y->score) {
+            return x->score < y->score ? 1 : -1;
+        }
+        // On equal scores the newest comment comes first.
+        return compareInts(&y->comment, &x->comment);
+    }
+
+    /*
+     * Restores the heap of the best matches from position i down. The worst of the matches
+     * kept is at the root, so it is the one replaced when a better match is found.
+     */
+    static void siftDownMatch(CommentMatch heap[], int count, int i) {
+        while (2 * i + 1 < count) {
+            int child = 2 * i + 1;
+
+            if (child + 1 < count && compareMatchesByScore(&heap[child + 1], &heap[child]) > 0) {
+                child++;
+            }
+            if (compareMatchesByScore(&heap[child], &heap[i]) <= 0) {
+                return;
+            }
+
+            CommentMatch match = heap[i];
+            heap[i] = heap[child];
+            heap[child] = match;
+            i = child;
+        }
+    }
+
+    static void siftUpMatch(CommentMatch heap[], int i) {
+        while (i > 0 && compareMatchesByScore(&heap[i], &heap[(i - 1) / 2]) > 0) {
+            CommentMatch match = heap[i];
+            heap[i] = heap[(i - 1) / 2];
+            heap[(i - 1) / 2] = match;
+            i = (i - 1) / 2;
+        }
+    }
+
+    void indexNewComments() {
+        if (indexBuilt) {
+            catchUpCommentSearchIndex();
+        }
+    }
+
+    int searchComments(const char *query, int maxResults, CommentMatch results[]) {
+        int ids[100];
+        int numIds;
+        int numMatches = 0;
+
+        indexBuilt = 1;
+        catchUpCommentSearchIndex();
+
+        numIds = collectWords(query, 0, ids, sizeof(ids) / sizeof(ids[0]));
+        if (numIds == 0 || numIndexedComments == 0 || maxResults <= 0) {
+            return 0;
+        }
+
+        // Repeated query words count once.
+        qsort(ids, numIds, sizeof(int), compareInts);
+        int unique = 0;
+        for (int i = 0; i < numIds; i++) {
+            if ((unique == 0 || ids[unique - 1] != ids[i]) && ids[i] < postingsCapacity) {
+                ids[unique++] = ids[i];
+            }
+        }
+        numIds = unique;
+
+        double averageLength = (double) totalLength / numIndexedComments;
+        if (averageLength <= 0) {
+            averageLength = 1;
+        }
+
+        // Each word adds its part of the score of the comments containing it.
+        for (int i = 0; i < numIds; i++) {
+            const CommentPostingList *list = &wordPostings[ids[i]];
+            double idf = log(1 + (numIndexedComments - list->count + 0.5) / (list->count + 0.5));
+
+            for (int j = 0; j < list->count; j++) {
+                double frequency = list->postings[j].frequency;
+                double norm = 1 - BM25_B + BM25_B * commentLengths[list->postings[j].comment] / averageLength;
+
+                commentScores[list->postings[j].comment] += idf * frequency * (BM25_K1 + 1) / (frequency + BM25_K1 * norm);
+            }
+        }
+
+        // Going through the postings again, each comment scored is offered once to the heap of
+        // the best matches, the first time it is met, and its score is cleared for the next search.
+        for (int i = 0; i < numIds; i++) {
+            const CommentPostingList *list = &wordPostings[ids[i]];
+
+            for (int j = 0; j < list->count; j++) {
+                CommentMatch match = {list->postings[j].comment, 0, commentScores[list->postings[j].comment]};
+
+                if (match.score == 0) {
+                    continue;
+                }
+                commentScores[match.comment] = 0;
+
+                if (numMatches < maxResults) {
+                    results[numMatches] = match;
+                    siftUpMatch(results, numMatches++);
+                } else if (compareMatchesByScore(&match, &results[0]) < 0) {
+                    results[0] = match;
+                    siftDownMatch(results, numMatches, 0);
+                }
+            }
+        }
+
+        qsort(results, numMatches, sizeof(CommentMatch), compareMatchesByScore);
+        for (int i = 0; i < numMatches; i++) {
+            results[i].nif = commentNifs[results[i].comment];
+        }
+        return numMatches;
+    }
+
+    void freeCommentSearchIndex() {
+        for (int i = 0; i < postingsCapacity; i++) {
+            free(wordPostings[i].postings);
+        }
+        free(wordPostings);
+        wordPostings = NULL;
+        postingsCapacity = 0;
+
+        for (int i = 0; i < words.count; i++) {
+            free(words.names[i]);
+        }
+        free(words.names);
+        free(words.buckets);
+        memset(&words, 0, sizeof(words));
+
+        free(commentLengths);
+        free(commentNifs);
+        free(commentScores);
+        commentLengths = NULL;
+        commentNifs = NULL;
+        commentScores = NULL;
+        numIndexedComments = 0;
+        lengthsCapacity = 0;
+        totalLength = 0;
+        indexBuilt = 0;
+    }
@@ -0,0 +1,93 @@
+/**
+ * @file commentsearch.h
+ * @brief Header file for the full-text search over the comments of the Company Management System.
+ *
+ * The titles and texts of the comments are split into lowercase words. An inverted index maps each
+ * word to the comments containing it, with the number of times it occurs, and the length of each
+ * comment is kept, so the matches of a query are ranked with BM25 without reading the comments.
+ * The scores are summed in an array by comment number and only the best matches are kept, in
+ * a heap as large as the results asked for. Only those are then read from the comment log.
+ *
+ * The index is built from the comment log the first time comments are searched, and afterwards
+ * takes in the comments added to the log since.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef COMMENTSEARCH_H
+#define COMMENTSEARCH_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief BM25 term frequency saturation.
+     */
+    #define BM25_K1 1.2
+
+    /**
+     * @brief BM25 length normalization.
+     */
+    #define BM25_B 0.75
+
+    /**
+     * @brief One comment containing a word, with the number of times it occurs.
+     */
+    typedef struct {
+        int comment;
+        int frequency;
+    } CommentPosting;
+
+    /**
+     * @brief The comments containing one word, in the order they were added.
+     */
+    typedef struct {
+        CommentPosting* postings;
+        int count;
+        int capacity;
+    } CommentPostingList;
+
+    /**
+     * @brief One comment matching a query.
+     */
+    typedef struct {
+        int comment;  // number of the comment in the log
+        int nif;      // NIF of the company commented on
+        double score;
+    } CommentMatch;
+
+    /**
+     * @brief Indexes the comments added to the log since the index was last updated.
+     *
+     * Does nothing until the index has been built by a first search.
+     *
+     * @return void - This function does not return a value.
+     */
+    void indexNewComments();
+
+    /**
+     * @brief Finds the comments best matching a query.
+     *
+     * @param query The words to search for.
+     * @param maxResults The capacity of the results array.
+     * @param results An array receiving the matches, best first.
+     * @return The number of matches written to the array, or -1 on failure.
+     */
+    int searchComments(const char* query, int maxResults, CommentMatch results[]);
+
+    /**
+     * @brief Frees the memory of the index.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freeCommentSearchIndex();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMENTSEARCH_H */
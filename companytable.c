@@ -0,0 +1,337 @@
+/**
+ * @file companytable.c
+ * @brief source file for the growable company table of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "companytable.h"
+#include "symbols.h"
+
+    static Company *slotAddress(const CompanyTable *table, int slot) {
+        unsigned int block = (unsigned int) slot / COMPANY_FIRST_CHUNK + 1;
+        int chunk = 31 - __builtin_clz(block);
+        int offset = slot - COMPANY_FIRST_CHUNK * ((1 << chunk) - 1);
+
+        return table->chunks[chunk] != NULL ? &table->chunks[chunk][offset] : NULL;
+    }
+
+    static int growChunks(CompanyTable *table) {
+        if (table->numChunks >= COMPANY_MAX_CHUNKS) {
+            printf("Maximum number of companies reached.\n");
+            return 0;
+        }
+
+        Company *chunk = calloc((size_t) COMPANY_FIRST_CHUNK << table->numChunks, sizeof(Company));
+        if (chunk == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        table->chunks[table->numChunks++] = chunk;
+        table->capacity = COMPANY_FIRST_CHUNK * ((1 << table->numChunks) - 1);
+        return 1;
+    }
+
+    static int reserveOrder(CompanyTable *table) {
+        if (table->count < table->orderCapacity) {
+            return 1;
+        }
+
+        int capacity = table->orderCapacity > 0 ? table->orderCapacity * 2 : COMPANY_FIRST_CHUNK;
+        Company **order = realloc(table->order, capacity * sizeof(Company *));
+        if (order == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        table->order = order;
+        table->orderCapacity = capacity;
+        return 1;
+    }
+
+    /*
+     * Makes room in the list of free slots for every slot handed out, so that removing a
+     * company never has to allocate.
+     */
+    static int reserveFreeSlots(CompanyTable *table) {
+        if (table->numSlots < table->freeCapacity) {
+            return 1;
+        }
+
+        int capacity = table->freeCapacity > 0 ? table->freeCapacity * 2 : COMPANY_FIRST_CHUNK;
+        int *freeSlots = realloc(table->freeSlots, capacity * sizeof(int));
+        if (freeSlots == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        table->freeSlots = freeSlots;
+        table->freeCapacity = capacity;
+        return 1;
+    }
+
+    static unsigned int nifHash(int nif, int capacity) {
+        return ((unsigned int) nif * 2654435761u) & (capacity - 1);
+    }
+
+    static void putNifEntry(NifEntry *entries, int capacity, NifEntry entry) {
+        unsigned int i = nifHash(entry.nif, capacity);
+
+        while (entries[i].slot != -1) {
+            i = (i + 1) & (capacity - 1);
+        }
+        entries[i] = entry;
+    }
+
+    static int growNifIndex(CompanyTable *table) {
+        int capacity = table->nifCapacity > 0 ? table->nifCapacity * 2 : COMPANY_FIRST_CHUNK;
+        NifEntry *entries = malloc(capacity * sizeof(NifEntry));
+
+        if (entries == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        for (int i = 0; i < capacity; i++) {
+            entries[i].slot = -1;
+        }
+        for (int i = 0; i < table->nifCapacity; i++) {
+            if (table->nifIndex[i].slot != -1) {
+                putNifEntry(entries, capacity, table->nifIndex[i]);
+            }
+        }
+
+        free(table->nifIndex);
+        table->nifIndex = entries;
+        table->nifCapacity = capacity;
+        return 1;
+    }
+
+    /*
+     * Deletes an entry and shifts the entries of its probe run back, so that lookups
+     * never need tombstones.
+     */
+    static void unindexCompanyNif(CompanyTable *table, const Company *company) {
+        if (table->nifCapacity == 0) {
+            return;
+        }
+
+        unsigned int mask = table->nifCapacity - 1;
+        unsigned int hole = nifHash(company->nif, table->nifCapacity);
+
+        while (table->nifIndex[hole].slot != company->tableSlot) {
+            if (table->nifIndex[hole].slot == -1) {
+                return;
+            }
+            hole = (hole + 1) & mask;
+        }
+
+        for (unsigned int next = (hole + 1) & mask; table->nifIndex[next].slot != -1; next = (next + 1) & mask) {
+            unsigned int home = nifHash(table->nifIndex[next].nif, table->nifCapacity);
+
+            // The entry may move into the hole only if the hole lies between its home and itself.
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                table->nifIndex[hole] = table->nifIndex[next];
+                hole = next;
+            }
+        }
+
+        table->nifIndex[hole].slot = -1;
+        table->nifCount--;
+    }
+
+    Company *companyAt(const CompanyTable *table, int position) {
+        if (position < 0 || position >= table->count) {
+            return NULL;
+        }
+        return table->order[position];
+    }
+
+    Company *companyBySlot(const CompanyTable *table, int slot) {
+        if (slot < 0 || slot >= table->numSlots) {
+            return NULL;
+        }
+
+        Company *company = slotAddress(table, slot);
+        return company != NULL && company->tableSlot == slot ? company : NULL;
+    }
+
+    Company *addCompany(CompanyTable *table) {
+        int slot;
+
+        if (!reserveOrder(table)) {
+            return NULL;
+        }
+
+        if (table->numFreeSlots > 0) {
+            slot = table->freeSlots[--table->numFreeSlots];
+        } else {
+            if ((table->numSlots >= table->capacity && !growChunks(table)) || !reserveFreeSlots(table)) {
+                return NULL;
+            }
+            slot = table->numSlots++;
+        }
+
+        Company *company = slotAddress(table, slot);
+        memset(company, 0, sizeof(Company));
+        company->tableSlot = slot;
+        company->storeSlot = -1;
+        company->sectorId = -1;
+        company->postalCodeValue = -1;
+        company->position = table->count;
+
+        table->order[table->count++] = company;
+        return company;
+    }
+
+    int indexCompanyNif(CompanyTable *table, Company *company) {
+        if (findCompanyByNif(table, company->nif) != NULL) {
+            return 0;
+        }
+        if ((table->nifCount + 1) * 10 > table->nifCapacity * 7 && !growNifIndex(table)) {
+            return 0;
+        }
+
+        NifEntry entry = {company->nif, company->tableSlot};
+        putNifEntry(table->nifIndex, table->nifCapacity, entry);
+        table->nifCount++;
+        return 1;
+    }
+
+    Company *findCompanyByNif(const CompanyTable *table, int nif) {
+        if (table->nifCount == 0) {
+            return NULL;
+        }
+
+        unsigned int i = nifHash(nif, table->nifCapacity);
+
+        while (table->nifIndex[i].slot != -1) {
+            if (table->nifIndex[i].nif == nif) {
+                return companyBySlot(table, table->nifIndex[i].slot);
+            }
+            i = (i + 1) & (table->nifCapacity - 1);
+        }
+        return NULL;
+    }
+
+    int setCompanySector(CompanyTable *table, Company *company, int sectorId) {
+        if (sectorId < 0) {
+            return 0;
+        }
+
+        if (sectorId >= table->sectorUsageCapacity) {
+            int capacity = table->sectorUsageCapacity > 0 ? table->sectorUsageCapacity : INITIAL_BUFFER_SIZE;
+            while (capacity <= sectorId) {
+                capacity *= 2;
+            }
+
+            int *sectorUsage = realloc(table->sectorUsage, capacity * sizeof(int));
+            if (sectorUsage == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            memset(&sectorUsage[table->sectorUsageCapacity], 0, (capacity - table->sectorUsageCapacity) * sizeof(int));
+            table->sectorUsage = sectorUsage;
+            table->sectorUsageCapacity = capacity;
+        }
+
+        if (company->sectorId >= 0) {
+            table->sectorUsage[company->sectorId]--;
+        }
+        company->sectorId = sectorId;
+        table->sectorUsage[sectorId]++;
+        return 1;
+    }
+
+    void setCompanyName(Company *company, const char *name) {
+        if (name != company->name) {
+            snprintf(company->name, sizeof(company->name), "%s", name);
+        }
+        foldText(company->nameKey, sizeof(company->nameKey), company->name);
+    }
+
+    void setCompanyLocality(Company *company, const char *locality) {
+        company->localityId = internSymbol(&localitySymbols, locality);
+        foldText(company->localityKey, sizeof(company->localityKey), locality);
+    }
+
+    void setCompanyPostalCode(Company *company, const char *postalCode) {
+        if (postalCode != company->postalCode) {
+            snprintf(company->postalCode, sizeof(company->postalCode), "%s", postalCode);
+        }
+        company->postalCodeValue = encodePostalCode(company->postalCode);
+    }
+
+    void setCompanyActive(CompanyTable *table, Company *company, int active) {
+        company->active = active ? 1 : 0;
+
+        if (company->active) {
+            bitmapAdd(&table->activeSlots, company->tableSlot);
+        } else {
+            bitmapRemove(&table->activeSlots, company->tableSlot);
+        }
+    }
+
+    int countCompaniesInSector(const CompanyTable *table, int sectorId) {
+        return sectorId >= 0 && sectorId < table->sectorUsageCapacity ? table->sectorUsage[sectorId] : 0;
+    }
+
+    void removeCompanyFromTable(CompanyTable *table, Company *company) {
+        int position = company->position;
+
+        if (position < 0 || position >= table->count || table->order[position] != company) {
+            return;
+        }
+
+        // The last company fills the gap, so nothing has to be shifted.
+        Company *last = table->order[--table->count];
+        table->order[position] = last;
+        last->position = position;
+        unindexCompanyNif(table, company);
+        if (company->sectorId >= 0) {
+            table->sectorUsage[company->sectorId]--;
+        }
+        bitmapRemove(&table->activeSlots, company->tableSlot);
+
+        // The last slot handed out is simply taken back, so undoing the latest additions leaves
+        // the table as it was. Otherwise there is always room in the free slots: addCompany
+        // reserved it when the slot was first handed out.
+        if (company->tableSlot == table->numSlots - 1) {
+            table->numSlots--;
+        } else {
+            table->freeSlots[table->numFreeSlots++] = company->tableSlot;
+        }
+        company->tableSlot = -1;
+    }
+
+    void clearCompanyTable(CompanyTable *table) {
+        for (int i = 0; i < table->count; i++) {
+            table->order[i]->tableSlot = -1;
+        }
+        table->count = 0;
+        table->numSlots = 0;
+        table->numFreeSlots = 0;
+        for (int i = 0; i < table->nifCapacity; i++) {
+            table->nifIndex[i].slot = -1;
+        }
+        table->nifCount = 0;
+        if (table->sectorUsage != NULL) {
+            memset(table->sectorUsage, 0, table->sectorUsageCapacity * sizeof(int));
+        }
+        clearBitmap(&table->activeSlots);
+    }
+
+    void freeCompanyTable(CompanyTable *table) {
+        for (int i = 0; i < table->numChunks; i++) {
+            free(table->chunks[i]);
+        }
+        free(table->order);
+        free(table->freeSlots);
+        free(table->nifIndex);
+        free(table->sectorUsage);
+        freeBitmap(&table->activeSlots);
+        memset(table, 0, sizeof(CompanyTable));
+    }
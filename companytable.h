@@ -0,0 +1,179 @@
+/**
+ * @file companytable.h
+ * @brief Header file for the growable company table of the Company Management System.
+ *
+ * The records live in chunks that are never moved: chunk k holds COMPANY_FIRST_CHUNK << k
+ * records, so the table doubles its capacity with each new chunk and the address of a record
+ * stays the same for as long as the company exists. Indexes may therefore keep pointers to
+ * records, or their slot numbers.
+ *
+ * The slot of a removed company is reused by the next company added. The listing order of
+ * the live companies is kept in a separate array of pointers, and each company knows its
+ * position there, so a company is removed in constant time by moving the last one into its
+ * place. Room in the list of free slots is reserved as each slot is handed out, so removing
+ * a company never allocates and cannot fail.
+ *
+ * The table also keeps a hash index from NIF to slot, using open addressing with linear
+ * probing. A company is indexed once its NIF is known and leaves the index when it is removed.
+ *
+ * Finally, it counts the companies of each business sector, so whether a sector is still in use
+ * is known without looking at the companies. The sector of a company is therefore only set
+ * through setCompanySector.
+ *
+ * The slots of the active companies are kept in a bitmap, so listings go through the active
+ * companies only. The status of a company is therefore only set through setCompanyActive.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef COMPANYTABLE_H
+#define COMPANYTABLE_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Gets the company at a position of the listing order.
+     *
+     * @param table The company table.
+     * @param position The position, from 0 to table->count - 1.
+     * @return The company, or NULL if the position is out of range.
+     */
+    Company* companyAt(const CompanyTable* table, int position);
+
+    /**
+     * @brief Gets the company stored in a slot.
+     *
+     * @param table The company table.
+     * @param slot The slot of the company.
+     * @return The company, or NULL if the slot is free or out of range.
+     */
+    Company* companyBySlot(const CompanyTable* table, int slot);
+
+    /**
+     * @brief Adds an empty company at the end of the listing order.
+     *
+     * The record is zeroed, its table slot is set, it has no business sector and it is not in the
+     * store yet.
+     *
+     * @param table The company table.
+     * @return The new company, or NULL if memory could not be allocated.
+     */
+    Company* addCompany(CompanyTable* table);
+
+    /**
+     * @brief Removes a company from the table and from the NIF index, and frees its slot for reuse.
+     *
+     * The last company of the listing order takes the position of the removed one.
+     *
+     * @param table The company table.
+     * @param company The company to remove.
+     * @return void - This function does not return a value.
+     */
+    void removeCompanyFromTable(CompanyTable* table, Company* company);
+
+    /**
+     * @brief Adds a company to the NIF index, once its NIF has been set.
+     *
+     * @param table The company table.
+     * @param company The company.
+     * @return 1 on success, 0 if another company already has the same NIF or memory could not be allocated.
+     */
+    int indexCompanyNif(CompanyTable* table, Company* company);
+
+    /**
+     * @brief Finds a company by its NIF, using the NIF index.
+     *
+     * @param table The company table.
+     * @param nif The NIF of the company.
+     * @return The company, or NULL if no company has this NIF.
+     */
+    Company* findCompanyByNif(const CompanyTable* table, int nif);
+
+    /**
+     * @brief Sets the business sector of a company, keeping the sector counts up to date.
+     *
+     * @param table The company table.
+     * @param company The company.
+     * @param sectorId The id of the business sector in sectorSymbols.
+     * @return 1 on success, 0 if the id is invalid or memory could not be allocated.
+     */
+    int setCompanySector(CompanyTable* table, Company* company, int sectorId);
+
+    /**
+     * @brief Sets the name of a company and its folded search key.
+     *
+     * The name must be removed from the trigram index before it is changed.
+     *
+     * @param company The company.
+     * @param name The name, truncated if too long.
+     * @return void - This function does not return a value.
+     */
+    void setCompanyName(Company* company, const char* name);
+
+    /**
+     * @brief Sets the locality of a company and its folded search key.
+     *
+     * The locality must be removed from the trigram and facet indexes before it is changed.
+     *
+     * @param company The company.
+     * @param locality The name of the locality, interned in localitySymbols.
+     * @return void - This function does not return a value.
+     */
+    void setCompanyLocality(Company* company, const char* locality);
+
+    /**
+     * @brief Sets the postal code of a company and its packed value.
+     *
+     * The postal code must be removed from the postal code index before it is changed.
+     *
+     * @param company The company.
+     * @param postalCode The postal code, truncated if too long.
+     * @return void - This function does not return a value.
+     */
+    void setCompanyPostalCode(Company* company, const char* postalCode);
+
+    /**
+     * @brief Activates or deactivates a company, keeping the bitmap of active companies up to date.
+     *
+     * @param table The company table.
+     * @param company The company.
+     * @param active 1 to activate the company, 0 to deactivate it.
+     * @return void - This function does not return a value.
+     */
+    void setCompanyActive(CompanyTable* table, Company* company, int active);
+
+    /**
+     * @brief Gets the number of companies of a business sector.
+     *
+     * @param table The company table.
+     * @param sectorId The id of the business sector in sectorSymbols.
+     * @return The number of companies in the table with this sector.
+     */
+    int countCompaniesInSector(const CompanyTable* table, int sectorId);
+
+    /**
+     * @brief Removes every company from the table, keeping the allocated chunks.
+     *
+     * @param table The company table.
+     * @return void - This function does not return a value.
+     */
+    void clearCompanyTable(CompanyTable* table);
+
+    /**
+     * @brief Frees all the memory of the table.
+     *
+     * @param table The company table.
+     * @return void - This function does not return a value.
+     */
+    void freeCompanyTable(CompanyTable* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMPANYTABLE_H */
@@ -0,0 +1,438 @@
+/**
+ * @file csvimport.c
+ * @brief source file for the bulk import of companies of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <pthread.h>
+#include <strings.h>
+#include <unistd.h>
+#include "csvimport.h"
+#include "textscan.h"
+#include "companytable.h"
+#include "symbols.h"
+
+/**
+ * @brief Number of fields of a line.
+ */
+#define IMPORT_NUM_FIELDS 7
+
+/**
+ * @brief Reasons for rejecting a line.
+ */
+typedef enum {
+    PROBLEM_NONE,
+    PROBLEM_FIELDS,
+    PROBLEM_QUOTES,
+    PROBLEM_NIF,
+    PROBLEM_NAME,
+    PROBLEM_CATEGORY,
+    PROBLEM_SECTOR,
+    PROBLEM_INACTIVE_SECTOR,
+    PROBLEM_STREET,
+    PROBLEM_LOCALITY,
+    PROBLEM_POSTAL_CODE,
+    PROBLEM_DUPLICATE
+} ImportProblem;
+
+static const char *problemMessages[] = {
+    "",
+    "Expected 7 fields: nif,name,category,business sector,street,locality,postal code.",
+    "Quote not closed, or not followed by a comma.",
+    "Invalid NIF. The NIF must have 9 digits.",
+    "Invalid name. The name must have 1 to 99 characters.",
+    "Invalid category. The category must be MICRO, SMALL, MEDIUM, or BIG.",
+    "Unknown business sector.",
+    "Inactive business sector.",
+    "Invalid street. The street must have at most 49 characters.",
+    "Invalid locality. The locality must have 1 to 49 characters.",
+    "Invalid Postal Code (e.g., 1231-012).",
+    "A company with this NIF already exists."
+};
+
+/**
+ * @brief A line that passed validation. The text fields point into the mapped file.
+ */
+typedef struct {
+    int line;  // number of the line inside its chunk
+    int nif;
+    Categoria category;
+    int sectorId;
+    TextToken name;
+    TextToken street;
+    TextToken locality;
+    TextToken postalCode;
+} ImportRow;
+
+/**
+ * @brief A line that failed validation.
+ */
+typedef struct {
+    int line;  // number of the line inside its chunk
+    ImportProblem problem;
+} ImportRejection;
+
+/**
+ * @brief The lines of the file given to one thread, and what it found in them.
+ */
+typedef struct {
+    TextScanner scanner;  // limited to the lines of the chunk
+    const BusinessSectorList *sectors;
+    int first;  // 1 for the chunk at the start of the file, which may hold the column names
+    ImportRow *rows;
+    int numRows;
+    int rowCapacity;
+    ImportRejection *rejections;
+    int numRejections;
+    int rejectionCapacity;
+    int failed;  // 1 if memory ran out
+} ImportChunk;
+
+    static TextToken trimToken(const char *start, const char *stop) {
+        while (start < stop && (*start == ' ' || *start == '\t')) {
+            start++;
+        }
+        while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t')) {
+            stop--;
+        }
+        return (TextToken) {start, stop - start};
+    }
+
+    /*
+     * Splits a line into its fields. Quoted fields are returned without their quotes, with the
+     * doubled quotes still in them. Returns the number of fields, or -1 if a quote is not closed.
+     */
+    static int splitCsvLine(TextToken line, TextToken fields[], int maxFields) {
+        const char *cursor = line.start;
+        const char *end = line.start + line.length;
+        int numFields = 0;
+
+        while (1) {
+            TextToken field;
+
+            if (cursor < end && *cursor == '"') {
+                const char *start = ++cursor;
+
+                while ((cursor = memchr(cursor, '"', end - cursor)) != NULL && cursor + 1 < end && cursor[1] == '"') {
+                    cursor += 2;
+                }
+                if (cursor == NULL) {
+                    return -1;
+                }
+                field = (TextToken) {start, cursor - start};
+                if (++cursor < end && *cursor != ',') {
+                    return -1;
+                }
+            } else {
+                const char *comma = memchr(cursor, ',', end - cursor);
+                const char *stop = comma != NULL ? comma : end;
+
+                field = trimToken(cursor, stop);
+                cursor = stop;
+            }
+
+            if (numFields < maxFields) {
+                fields[numFields] = field;
+            }
+            numFields++;
+
+            if (cursor >= end) {
+                return numFields;
+            }
+            cursor++;
+        }
+    }
+
+    /*
+     * Copies a field, turning doubled quotes into single ones. Returns the length of the whole
+     * field, which was truncated if it is not smaller than size.
+     */
+    static size_t copyCsvField(char *dest, size_t size, TextToken field) {
+        size_t length = 0;
+
+        for (size_t i = 0; i < field.length; i++) {
+            if (field.start[i] == '"' && i + 1 < field.length && field.start[i + 1] == '"') {
+                i++;
+            }
+            if (length + 1 < size) {
+                dest[length] = field.start[i];
+            }
+            length++;
+        }
+        dest[length < size ? length : size - 1] = '\0';
+        return length;
+    }
+
+    /*
+     * Validates a line with the checks of createCompany.
+     */
+    static ImportProblem parseCompanyLine(const BusinessSectorList *sectors, TextToken line, ImportRow *row) {
+        TextToken fields[IMPORT_NUM_FIELDS];
+        char text[100];
+        size_t length;
+        int numFields = splitCsvLine(line, fields, IMPORT_NUM_FIELDS);
+
+        if (numFields < 0) {
+            return PROBLEM_QUOTES;
+        }
+        if (numFields != IMPORT_NUM_FIELDS) {
+            return PROBLEM_FIELDS;
+        }
+
+        if (!tokenToInt(fields[0], &row->nif) || row->nif < 100000000 || row->nif > 999999999) {
+            return PROBLEM_NIF;
+        }
+
+        length = copyCsvField(text, sizeof(text), fields[1]);
+        if (length == 0 || length >= sizeof(((Company *) 0)->name)) {
+            return PROBLEM_NAME;
+        }
+        row->name = fields[1];
+
+        copyCsvField(text, sizeof(text), fields[2]);
+        row->category = parseCategory(text);
+        if (row->category == 0) {
+            return PROBLEM_CATEGORY;
+        }
+
+        copyCsvField(text, sizeof(text), fields[3]);
+        int position = findBusinessSector(sectors, text);
+        if (position < 0) {
+            return PROBLEM_SECTOR;
+        }
+        if (!sectors->activeStatus[position]) {
+            return PROBLEM_INACTIVE_SECTOR;
+        }
+        row->sectorId = sectors->sectorIds[position];
+
+        if (copyCsvField(text, sizeof(text), fields[4]) >= sizeof(((Company *) 0)->street)) {
+            return PROBLEM_STREET;
+        }
+        row->street = fields[4];
+
+        length = copyCsvField(text, sizeof(text), fields[5]);
+        if (length == 0 || length >= sizeof(((Company *) 0)->localityKey)) {
+            return PROBLEM_LOCALITY;
+        }
+        row->locality = fields[5];
+
+        if (copyCsvField(text, sizeof(text), fields[6]) >= sizeof(((Company *) 0)->postalCode) ||
+                !isValidPostalCode(text)) {
+            return PROBLEM_POSTAL_CODE;
+        }
+        row->postalCode = fields[6];
+        return PROBLEM_NONE;
+    }
+
+    static int addImportRow(ImportChunk *chunk, const ImportRow *row) {
+        if (chunk->numRows == chunk->rowCapacity) {
+            int capacity = chunk->rowCapacity > 0 ? chunk->rowCapacity * 2 : INITIAL_BUFFER_SIZE;
+            ImportRow *grown = realloc(chunk->rows, capacity * sizeof(ImportRow));
+
+            if (grown == NULL) {
+                return 0;
+            }
+            chunk->rows = grown;
+            chunk->rowCapacity = capacity;
+        }
+        chunk->rows[chunk->numRows++] = *row;
+        return 1;
+    }
+
+    static int addImportRejection(ImportChunk *chunk, int line, ImportProblem problem) {
+        if (chunk->numRejections == chunk->rejectionCapacity) {
+            int capacity = chunk->rejectionCapacity > 0 ? chunk->rejectionCapacity * 2 : INITIAL_BUFFER_SIZE;
+            ImportRejection *grown = realloc(chunk->rejections, capacity * sizeof(ImportRejection));
+
+            if (grown == NULL) {
+                return 0;
+            }
+            chunk->rejections = grown;
+            chunk->rejectionCapacity = capacity;
+        }
+        chunk->rejections[chunk->numRejections++] = (ImportRejection) {line, problem};
+        return 1;
+    }
+
+    /*
+     * Body of the parsing threads. Nothing is printed here, so the messages of different
+     * chunks do not mix; they are printed in the order of the file afterwards.
+     */
+    static void *parseImportChunk(void *argument) {
+        ImportChunk *chunk = argument;
+        TextToken line;
+
+        while (!chunk->failed && nextLine(&chunk->scanner, &line)) {
+            ImportRow row;
+
+            if (trimToken(line.start, line.start + line.length).length == 0) {
+                continue;
+            }
+            if (chunk->first && chunk->scanner.line == 1 && line.length >= 3 && strncasecmp(line.start, "nif", 3) == 0) {
+                continue;
+            }
+
+            row.line = chunk->scanner.line;
+            ImportProblem problem = parseCompanyLine(chunk->sectors, line, &row);
+            chunk->failed = problem == PROBLEM_NONE ? !addImportRow(chunk, &row) :
+                    !addImportRejection(chunk, row.line, problem);
+        }
+        return NULL;
+    }
+
+    static void reportRejection(const char *path, int line, ImportProblem problem, int *numRejected) {
+        if (*numRejected < IMPORT_MAX_REPORTED) {
+            printf("%s:%d: %s\n", path, line, problemMessages[problem]);
+        }
+        (*numRejected)++;
+    }
+
+    /*
+     * Adds a validated line to the table, as createCompany does. Returns 0 if memory ran out.
+     */
+    static int addImportedCompany(CompanyTable *companies, const ImportRow *row) {
+        Company *company = addCompany(companies);
+        char text[100];
+
+        if (company == NULL) {
+            return 0;
+        }
+
+        company->nif = row->nif;
+        if (!indexCompanyNif(companies, company)) {
+            removeCompanyFromTable(companies, company);
+            return 0;
+        }
+
+        copyCsvField(company->name, sizeof(company->name), row->name);
+        setCompanyName(company, company->name);
+        company->category = row->category;
+        setCompanySector(companies, company, row->sectorId);
+        copyCsvField(company->street, sizeof(company->street), row->street);
+        copyCsvField(text, sizeof(text), row->locality);
+        setCompanyLocality(company, text);
+        copyCsvField(text, sizeof(text), row->postalCode);
+        setCompanyPostalCode(company, text);
+
+        setCompanyActive(companies, company, 1);
+        company->dirty = 1;
+        return 1;
+    }
+
+    int importCompaniesFromCsv(CompanyTable *companies, const BusinessSectorList *sectors, const char *path,
+            int *rejected) {
+        TextScanner scanner;
+        ImportChunk chunks[IMPORT_MAX_THREADS];
+        pthread_t threads[IMPORT_MAX_THREADS];
+        int started[IMPORT_MAX_THREADS] = {0};
+        int imported = 0;
+        int failed = 0;
+
+        *rejected = 0;
+        if (!openTextScanner(&scanner, path)) {
+            printf("Error opening %s.\n", path);
+            return -1;
+        }
+
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        size_t numChunks = scanner.size / IMPORT_MIN_CHUNK_SIZE + 1;
+        if (processors > 0 && numChunks > (size_t) processors) {
+            numChunks = processors;
+        }
+        if (numChunks > IMPORT_MAX_THREADS) {
+            numChunks = IMPORT_MAX_THREADS;
+        }
+
+        // Each chunk ends after the first line break past its share of the file.
+        const char *start = scanner.next;
+        for (size_t k = 0; k < numChunks; k++) {
+            const char *end = scanner.end;
+
+            if (k + 1 < numChunks) {
+                const char *split = scanner.next + scanner.size / numChunks * (k + 1);
+                const char *newline = split > start ? memchr(split, '\n', scanner.end - split) : NULL;
+                end = split <= start ? start : newline != NULL ? newline + 1 : scanner.end;
+            }
+
+            memset(&chunks[k], 0, sizeof(ImportChunk));
+            chunks[k].scanner = scanner;
+            chunks[k].scanner.next = start;
+            chunks[k].scanner.end = end;
+            chunks[k].sectors = sectors;
+            chunks[k].first = k == 0;
+            start = end;
+        }
+
+        // The first chunk is parsed by this thread while the others run.
+        for (size_t k = 1; k < numChunks; k++) {
+            started[k] = pthread_create(&threads[k], NULL, parseImportChunk, &chunks[k]) == 0;
+        }
+        parseImportChunk(&chunks[0]);
+        for (size_t k = 1; k < numChunks; k++) {
+            if (started[k]) {
+                pthread_join(threads[k], NULL);
+            } else {
+                parseImportChunk(&chunks[k]);
+            }
+            failed = failed || chunks[k].failed;
+        }
+        failed = failed || chunks[0].failed;
+
+        if (failed) {
+            printf("Memory allocation error.\n");
+        }
+
+        // Lines are added and reported in the order of the file, so the first of two lines with
+        // the same NIF is the one kept.
+        int first = companies->count;
+        int firstLocality = localitySymbols.count;
+        int lineOffset = 0;
+        for (size_t k = 0; k < numChunks && !failed; k++) {
+            ImportChunk *chunk = &chunks[k];
+            int row = 0;
+            int rejection = 0;
+
+            while (!failed && (row < chunk->numRows || rejection < chunk->numRejections)) {
+                if (row == chunk->numRows ||
+                        (rejection < chunk->numRejections && chunk->rejections[rejection].line < chunk->rows[row].line)) {
+                    reportRejection(path, lineOffset + chunk->rejections[rejection].line,
+                            chunk->rejections[rejection].problem, rejected);
+                    rejection++;
+                } else if (findCompanyByNif(companies, chunk->rows[row].nif) != NULL) {
+                    reportRejection(path, lineOffset + chunk->rows[row].line, PROBLEM_DUPLICATE, rejected);
+                    row++;
+                } else if (addImportedCompany(companies, &chunk->rows[row])) {
+                    imported++;
+                    row++;
+                } else {
+                    printf("Memory allocation error.\n");
+                    failed = 1;
+                }
+            }
+            lineOffset += chunk->scanner.line;
+        }
+
+        if (*rejected > IMPORT_MAX_REPORTED) {
+            printf("... and %d more lines rejected.\n", *rejected - IMPORT_MAX_REPORTED);
+        }
+
+        // An import is all or nothing: if memory ran out partway, the companies already added
+        // are removed again, the last first, which cannot fail and gives their slots back. The
+        // localities they brought in are forgotten too.
+        if (failed) {
+            while (companies->count > first) {
+                removeCompanyFromTable(companies, companyAt(companies, companies->count - 1));
+            }
+            truncateSymbols(&localitySymbols, firstLocality);
+        }
+
+        for (size_t k = 0; k < numChunks; k++) {
+            free(chunks[k].rows);
+            free(chunks[k].rejections);
+        }
+        closeTextScanner(&scanner);
+        return failed ? -1 : imported;
+    }
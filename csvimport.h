@@ -0,0 +1,69 @@
+/**
+ * @file csvimport.h
+ * @brief Header file for the bulk import of companies of the Company Management System.
+ *
+ * Companies are read from a CSV file with one company per line:
+ *
+ *   nif,name,category,business sector,street,locality,postal code
+ *   123456789,"Padaria Central, Lda",SMALL,Vendas,Rua Direita 10,Braga,4700-123
+ *
+ * A first line starting with "nif" is taken as the column names and skipped. Fields with commas
+ * or double quotes are written between double quotes, with the quotes inside doubled; fields
+ * cannot span lines.
+ *
+ * The file is mapped into memory and split into one chunk per processor at line boundaries.
+ * Each chunk is parsed and validated by its own thread, with the same checks as createCompany:
+ * NIF range, category, active business sector, lengths and isValidPostalCode. The lines that
+ * pass are then added to the table in the order of the file by the calling thread, which
+ * rejects NIFs already in the table or earlier in the file through the NIF index. Nothing is
+ * added if the file cannot be read or memory runs out, while parsing or while adding: the
+ * companies already added are then removed again.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef CSVIMPORT_H
+#define CSVIMPORT_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Largest number of threads parsing a file.
+     */
+    #define IMPORT_MAX_THREADS 16
+
+    /**
+     * @brief Smallest chunk given to a thread, in bytes, so small files are parsed by one thread.
+     */
+    #define IMPORT_MIN_CHUNK_SIZE (256 * 1024)
+
+    /**
+     * @brief Number of rejected lines printed; the others are only counted.
+     */
+    #define IMPORT_MAX_REPORTED 20
+
+    /**
+     * @brief Adds the companies of a CSV file to the table, as active companies.
+     *
+     * The rejected lines are printed as "path:line: reason". The companies added are appended
+     * to the table but not indexed nor saved.
+     *
+     * @param companies The company table.
+     * @param sectors The list of business sectors.
+     * @param path Path of the CSV file.
+     * @param rejected Receives the number of lines rejected.
+     * @return The number of companies added, or -1 if the file cannot be read or memory ran out, and none was added.
+     */
+    int importCompaniesFromCsv(CompanyTable* companies, const BusinessSectorList* sectors, const char* path,
+            int* rejected);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSVIMPORT_H */
@@ -0,0 +1,185 @@
+/**
+ * @file facet.c
+ * @brief source file for the facet indexes used to filter companies by category, business sector and locality.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "facet.h"
+#include "companytable.h"
+
+/**
+ * @brief The facet indexes over the categories, the business sectors and the localities.
+ */
+static FacetIndex categoryIndex;
+static FacetIndex sectorIndex;
+static FacetIndex localityIndex;
+
+    static FacetIndex *facetIndex(FacetField field) {
+        switch (field) {
+            case FACET_CATEGORY:
+                return &categoryIndex;
+            case FACET_SECTOR:
+                return &sectorIndex;
+            default:
+                return &localityIndex;
+        }
+    }
+
+    static PostingList *findFacetPostings(FacetFilter filter) {
+        FacetIndex *index = facetIndex(filter.field);
+
+        return filter.value >= 0 && filter.value < index->capacity ? &index->lists[filter.value] : NULL;
+    }
+
+    static PostingList *getFacetPostings(FacetIndex *index, int value) {
+        if (value < 0) {
+            return NULL;
+        }
+
+        if (value >= index->capacity) {
+            int capacity = index->capacity > 0 ? index->capacity : INITIAL_BUFFER_SIZE;
+            while (capacity <= value) {
+                capacity *= 2;
+            }
+
+            PostingList *lists = realloc(index->lists, capacity * sizeof(PostingList));
+            if (lists == NULL) {
+                printf("Memory allocation error.\n");
+                return NULL;
+            }
+            memset(&lists[index->capacity], 0, (capacity - index->capacity) * sizeof(PostingList));
+            index->lists = lists;
+            index->capacity = capacity;
+        }
+        return &index->lists[value];
+    }
+
+    static void addFacet(FacetIndex *index, int value, int slot) {
+        PostingList *postings = getFacetPostings(index, value);
+
+        if (postings != NULL) {
+            addPosting(postings, slot);
+        }
+    }
+
+    static void removeFacet(FacetIndex *index, int value, int slot) {
+        if (value >= 0 && value < index->capacity) {
+            removePosting(&index->lists[value], slot);
+        }
+    }
+
+    static void freeFacetIndex(FacetIndex *index) {
+        for (int i = 0; i < index->capacity; i++) {
+            freePostings(&index->lists[i]);
+        }
+        free(index->lists);
+        memset(index, 0, sizeof(FacetIndex));
+    }
+
+    void buildFacetIndexes(const CompanyTable *companies) {
+        freeFacetIndexes();
+
+        for (int i = 0; i < companies->count; i++) {
+            indexCompanyFacets(companyAt(companies, i));
+        }
+    }
+
+    void indexCompanyFacets(const Company *company) {
+        addFacet(&categoryIndex, company->category, company->tableSlot);
+        addFacet(&sectorIndex, company->sectorId, company->tableSlot);
+        addFacet(&localityIndex, company->localityId, company->tableSlot);
+    }
+
+    void unindexCompanyFacets(const Company *company) {
+        removeFacet(&categoryIndex, company->category, company->tableSlot);
+        removeFacet(&sectorIndex, company->sectorId, company->tableSlot);
+        removeFacet(&localityIndex, company->localityId, company->tableSlot);
+    }
+
+    /*
+     * Keeps only the slots that are also in a bitmap, intersecting both with word-level AND.
+     * Returns the number of slots kept, or -1 on failure.
+     */
+    static int restrictSlots(int *slots, int numSlots, const Bitmap *within) {
+        Bitmap matches = {0};
+        Bitmap kept = {0};
+        BitmapIterator iterator;
+        int ok = 1;
+        int count = 0;
+
+        for (int i = 0; i < numSlots && ok; i++) {
+            ok = bitmapAdd(&matches, slots[i]);
+        }
+        ok = ok && bitmapAnd(&matches, within, &kept);
+
+        bitmapIterate(&kept, &iterator);
+        while (ok && bitmapNext(&iterator, &slots[count])) {
+            count++;
+        }
+
+        freeBitmap(&matches);
+        freeBitmap(&kept);
+        return ok ? count : -1;
+    }
+
+    int countFacetMatches(FacetFilter filter) {
+        PostingList *list = findFacetPostings(filter);
+        return list != NULL ? list->count : 0;
+    }
+
+    int searchCompanyFacets(const CompanyTable *companies, const FacetFilter filters[], int numFilters,
+            const Bitmap *within, Company ***results) {
+        PostingList **lists = malloc(numFilters * sizeof(PostingList *));
+        int *slots;
+        int found = 0;
+
+        *results = NULL;
+        if (lists == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        for (int i = 0; i < numFilters; i++) {
+            lists[i] = findFacetPostings(filters[i]);
+            if (lists[i] == NULL || lists[i]->count == 0) {
+                free(lists);
+                return 0;
+            }
+        }
+
+        int numSlots = intersectPostings(lists, numFilters, &slots);
+        free(lists);
+        if (numSlots > 0 && within != NULL) {
+            numSlots = restrictSlots(slots, numSlots, within);
+        }
+        if (numSlots <= 0) {
+            free(slots);
+            return numSlots;
+        }
+
+        *results = malloc(numSlots * sizeof(Company *));
+        if (*results == NULL) {
+            printf("Memory allocation error.\n");
+            free(slots);
+            return -1;
+        }
+
+        for (int i = 0; i < numSlots; i++) {
+            Company *company = companyBySlot(companies, slots[i]);
+            if (company != NULL) {
+                (*results)[found++] = company;
+            }
+        }
+
+        free(slots);
+        return found;
+    }
+
+    void freeFacetIndexes() {
+        freeFacetIndex(&categoryIndex);
+        freeFacetIndex(&sectorIndex);
+        freeFacetIndex(&localityIndex);
+    }
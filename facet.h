@@ -0,0 +1,112 @@
+/**
+ * @file facet.h
+ * @brief Header file for the facet indexes used to filter companies by category, business sector and locality.
+ *
+ * Each category, business sector and locality has a posting list with the table slots of its
+ * companies. The lists of the sectors and localities are found by the id of the value in
+ * sectorSymbols and localitySymbols. A filter on one value returns its list directly, and a
+ * filter on several values intersects their lists, so the cost follows the size of the lists
+ * involved rather than the size of the catalog.
+ *
+ * The indexes are built once the catalog is loaded and are updated whenever a company is
+ * created, edited or removed.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef FACET_H
+#define FACET_H
+
+#include "utilities.h"
+#include "postings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Enumeration representing the fields that can be used as a facet.
+     */
+    typedef enum {
+        FACET_CATEGORY,
+        FACET_SECTOR,
+        FACET_LOCALITY
+    } FacetField;
+
+    /**
+     * @brief Structure representing a filter on one value of a facet.
+     */
+    typedef struct {
+        FacetField field;
+        int value;  // the category, or the id of the sector or locality
+    } FacetFilter;
+
+    /**
+     * @brief Posting lists of one facet, by value.
+     */
+    typedef struct {
+        PostingList* lists;
+        int capacity;
+    } FacetIndex;
+
+    /**
+     * @brief Builds the facet indexes from every company of the table.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void buildFacetIndexes(const CompanyTable* companies);
+
+    /**
+     * @brief Adds the category, business sector and locality of a company to the indexes.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void indexCompanyFacets(const Company* company);
+
+    /**
+     * @brief Removes the category, business sector and locality of a company from the indexes.
+     *
+     * Must be called before any of them is changed, or before the company is removed.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void unindexCompanyFacets(const Company* company);
+
+    /**
+     * @brief Finds the companies matching every filter.
+     *
+     * @param companies The company table.
+     * @param filters The filters.
+     * @param numFilters The number of filters, at least 1.
+     * @param within A bitmap of slots the results are restricted to, such as the active companies,
+     *        or NULL for no restriction.
+     * @param results Receives an array with the matching companies, to be freed by the caller.
+     * @return The number of matching companies, or -1 on failure.
+     */
+    int searchCompanyFacets(const CompanyTable* companies, const FacetFilter filters[], int numFilters,
+            const Bitmap* within, Company*** results);
+
+    /**
+     * @brief Gets the number of companies with one value of a facet, from the length of its posting list.
+     *
+     * @param filter The facet and its value.
+     * @return The number of companies.
+     */
+    int countFacetMatches(FacetFilter filter);
+
+    /**
+     * @brief Frees the memory of the indexes.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freeFacetIndexes();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FACET_H */
@@ -0,0 +1,104 @@
+/**
+ * @file fuzzy.c
+ * @brief source file for the typo tolerant search over the company names of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "fuzzy.h"
+#include "companytable.h"
+
+    static int compareFuzzyMatches(const void *a, const void *b) {
+        const FuzzyMatch *x = a;
+        const FuzzyMatch *y = b;
+
+        if (x->distance != y->distance) {
+            return x->distance - y->distance;
+        }
+        return strcmp(x->company->name, y->company->name);
+    }
+
+    void buildFuzzyPattern(FuzzyPattern *pattern, const char *term) {
+        char key[100];
+
+        memset(pattern, 0, sizeof(FuzzyPattern));
+        foldText(key, sizeof(key), term);
+
+        for (int i = 0; key[i] != '\0' && i < FUZZY_MAX_TERM_LENGTH; i++) {
+            pattern->masks[(unsigned char) key[i]] |= (uint64_t) 1 << i;
+            pattern->length++;
+        }
+    }
+
+    int fuzzyDistance(const FuzzyPattern *pattern, const char *text) {
+        if (pattern->length == 0) {
+            return 0;
+        }
+
+        uint64_t last = (uint64_t) 1 << (pattern->length - 1);
+        uint64_t pv = ~(uint64_t) 0;  // vertical deltas of +1 in the current column
+        uint64_t mv = 0;              // vertical deltas of -1 in the current column
+        int score = pattern->length;
+        int best = score;
+
+        // The first row stays at 0, so a match may start anywhere in the text.
+        for (const unsigned char *p = (const unsigned char *) text; *p != '\0'; p++) {
+            uint64_t eq = pattern->masks[*p];
+            uint64_t xv = eq | mv;
+            uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            uint64_t ph = mv | ~(xh | pv);
+            uint64_t mh = pv & xh;
+
+            if (ph & last) {
+                score++;
+            } else if (mh & last) {
+                score--;
+            }
+            if (score < best) {
+                best = score;
+            }
+
+            ph <<= 1;
+            mh <<= 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+        }
+        return best;
+    }
+
+    int fuzzyMaxDistance(const char *term) {
+        size_t length = strlen(term);
+
+        if (length <= 3) {
+            return 0;
+        }
+        return length >= 8 ? (int) length / 4 : 1;
+    }
+
+    int searchCompanyNamesFuzzy(const CompanyTable *companies, const char *term, int maxDistance, FuzzyMatch **results) {
+        FuzzyPattern pattern;
+        int found = 0;
+
+        *results = malloc((companies->count + 1) * sizeof(FuzzyMatch));
+        if (*results == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        buildFuzzyPattern(&pattern, term);
+        for (int i = 0; i < companies->count; i++) {
+            Company *company = companyAt(companies, i);
+            int distance = fuzzyDistance(&pattern, company->nameKey);
+
+            if (distance <= maxDistance) {
+                (*results)[found].company = company;
+                (*results)[found].distance = distance;
+                found++;
+            }
+        }
+
+        qsort(*results, found, sizeof(FuzzyMatch), compareFuzzyMatches);
+        return found;
+    }
@@ -0,0 +1,93 @@
+/**
+ * @file fuzzy.h
+ * @brief Header file for the typo tolerant search over the company names of the Company Management System.
+ *
+ * A name matches a term when some part of it can be turned into the term with a few single
+ * character insertions, deletions or substitutions, ignoring case and accents: the term is folded
+ * with foldText and matched against the folded key of each name. The distance of every name
+ * is computed with Myers' bit-parallel algorithm: the columns of the edit distance matrix are
+ * kept as bit vectors with one bit per character of the term, so each character of a name
+ * costs a handful of word operations and the whole name column can be scanned per query.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef FUZZY_H
+#define FUZZY_H
+
+#include <stdint.h>
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Longest term searched; longer terms are truncated. One bit per character of a 64-bit word.
+     */
+    #define FUZZY_MAX_TERM_LENGTH 64
+
+    /**
+     * @brief A term prepared for matching: for each byte, the positions of the term where it occurs.
+     */
+    typedef struct {
+        uint64_t masks[256];
+        int length;
+    } FuzzyPattern;
+
+    /**
+     * @brief A company matching a term, with the number of typos.
+     */
+    typedef struct {
+        Company* company;
+        int distance;
+    } FuzzyMatch;
+
+    /**
+     * @brief Prepares a term for matching, folding it with foldText.
+     *
+     * @param pattern The pattern.
+     * @param term The term.
+     * @return void - This function does not return a value.
+     */
+    void buildFuzzyPattern(FuzzyPattern* pattern, const char* term);
+
+    /**
+     * @brief Computes the smallest edit distance between the term and any part of a text.
+     *
+     * @param pattern The prepared term.
+     * @param text The text, already folded.
+     * @return The distance, 0 if the text contains the term.
+     */
+    int fuzzyDistance(const FuzzyPattern* pattern, const char* text);
+
+    /**
+     * @brief Number of typos a term of this length may have.
+     *
+     * Terms of 3 characters or fewer must match exactly, since a single typo would let them
+     * match almost every name; longer terms allow one typo for every four characters.
+     *
+     * @param term The search term.
+     * @return The largest distance to search with.
+     */
+    int fuzzyMaxDistance(const char* term);
+
+    /**
+     * @brief Finds the companies whose name is within a distance of a term.
+     *
+     * The matches are ordered by distance, then by name.
+     *
+     * @param companies The company table.
+     * @param term The search term.
+     * @param maxDistance The largest number of typos allowed.
+     * @param results Receives an array with the matches, to be freed by the caller.
+     * @return The number of matches, or -1 on failure.
+     */
+    int searchCompanyNamesFuzzy(const CompanyTable* companies, const char* term, int maxDistance, FuzzyMatch** results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FUZZY_H */
@@ -0,0 +1,483 @@
+/**
+ * @file journal.c
+ * @brief source file for the append-only rating journal of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "journal.h"
+#include "textscan.h"
+#include "companytable.h"
+
+/**
+ * @brief Serialises appends with the swap done at the end of a compaction.
+ */
+static pthread_mutex_t journalLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Descriptor used to append votes, opened on the first vote.
+ */
+static int journalFd = -1;
+
+/**
+ * @brief The background compaction thread, if one was started.
+ */
+static pthread_t compactionThread;
+static int compactionRunning = 0;
+
+    static int writeAll(int fd, const void *buffer, size_t length) {
+        const char *bytes = buffer;
+
+        while (length > 0) {
+            ssize_t written = write(fd, bytes, length);
+            if (written <= 0) {
+                return 0;
+            }
+            bytes += written;
+            length -= written;
+        }
+        return 1;
+    }
+
+    static JournalHeader makeJournalHeader(uint32_t sortedRecords) {
+        JournalHeader header = {JOURNAL_MAGIC, JOURNAL_VERSION, sizeof(RatingRecord), sortedRecords};
+        return header;
+    }
+
+    static int isValidJournalHeader(const JournalHeader *header) {
+        return header->magic == JOURNAL_MAGIC && header->version == JOURNAL_VERSION &&
+                header->recordSize == sizeof(RatingRecord);
+    }
+
+    static int openJournalLocked() {
+        if (journalFd >= 0) {
+            return 1;
+        }
+
+        int fd = open(JOURNAL_FILE, O_RDWR | O_CREAT | O_APPEND, 0644);
+        struct stat st;
+
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            return 0;
+        }
+
+        if (st.st_size == 0) {
+            JournalHeader header = makeJournalHeader(0);
+            if (!writeAll(fd, &header, sizeof(header))) {
+                close(fd);
+                return 0;
+            }
+        }
+
+        journalFd = fd;
+        return 1;
+    }
+
+    int appendRatingToJournal(int nif, float value) {
+        RatingRecord record = {nif, value, (int64_t) time(NULL)};
+
+        pthread_mutex_lock(&journalLock);
+        int ok = openJournalLocked() && writeAll(journalFd, &record, sizeof(record));
+        pthread_mutex_unlock(&journalLock);
+
+        if (!ok) {
+            printf("Error writing %s.\n", JOURNAL_FILE);
+        }
+        return ok;
+    }
+
+    int appendRemovalToJournal(int nif) {
+        return appendRatingToJournal(nif, JOURNAL_REMOVAL_VALUE);
+    }
+
+    static int isRemovalRecord(const RatingRecord *record) {
+        return record->value < 0;
+    }
+
+    static int compareNifs(const void *a, const void *b) {
+        int32_t x = *(const int32_t *) a;
+        int32_t y = *(const int32_t *) b;
+        return (x > y) - (x < y);
+    }
+
+    /*
+     * A journal record with its position in the journal, so sorting keeps the arrival
+     * order of votes given in the same second.
+     */
+    typedef struct {
+        RatingRecord record;
+        size_t position;
+    } JournalEntry;
+
+    static int compareJournalEntries(const void *a, const void *b) {
+        const JournalEntry *x = a;
+        const JournalEntry *y = b;
+
+        if (x->record.nif != y->record.nif) {
+            return (x->record.nif > y->record.nif) - (x->record.nif < y->record.nif);
+        }
+        if (x->record.timestamp != y->record.timestamp) {
+            return (x->record.timestamp > y->record.timestamp) - (x->record.timestamp < y->record.timestamp);
+        }
+        return (x->position > y->position) - (x->position < y->position);
+    }
+
+    /*
+     * Builds a journal from ratings.txt. The legacy file has one line per company:
+     * name, average, number of ratings and the ratings themselves. The name may contain
+     * spaces, so the line is split where the average and a matching count are found.
+     */
+    static void convertLegacyRatings(const CompanyTable *companies) {
+        TextScanner scanner;
+
+        if (!openTextScanner(&scanner, JOURNAL_LEGACY_FILE)) {
+            return;
+        }
+
+        FILE *journal = fopen(JOURNAL_FILE, "wb");
+        if (journal == NULL) {
+            printf("Error opening file for writing.\n");
+            closeTextScanner(&scanner);
+            return;
+        }
+
+        JournalHeader header = makeJournalHeader(0);
+        fwrite(&header, sizeof(header), 1, journal);
+
+        TextToken words[MAX_RATINGS + INITIAL_BUFFER_SIZE];
+        int maxWords = sizeof(words) / sizeof(words[0]);
+
+        while (nextLine(&scanner, NULL)) {
+            int numWords = 0;
+            while (numWords < maxWords && scanWord(&scanner, &words[numWords])) {
+                numWords++;
+            }
+            if (numWords == 0) {
+                continue;
+            }
+
+            int split = -1;
+            for (int p = 1; p + 2 <= numWords && split < 0; p++) {
+                float average;
+                int numRatings;
+
+                if (tokenToFloat(words[p], &average) && tokenToInt(words[p + 1], &numRatings) &&
+                        numRatings == numWords - p - 2) {
+                    split = p;
+                }
+            }
+            if (split < 0) {
+                reportScanError(&scanner, words[0].start, "expected name, average, number of ratings and ratings");
+                continue;
+            }
+
+            TextToken name = {words[0].start, words[split - 1].start + words[split - 1].length - words[0].start};
+            int nif = -1;
+            for (int i = 0; i < companies->count && nif == -1; i++) {
+                if (tokenEquals(name, companyAt(companies, i)->name)) {
+                    nif = companyAt(companies, i)->nif;
+                }
+            }
+
+            for (int w = split + 2; w < numWords && nif != -1; w++) {
+                RatingRecord record = {nif, 0, 0};
+
+                if (!tokenToFloat(words[w], &record.value)) {
+                    reportScanError(&scanner, words[w].start, "invalid rating");
+                    continue;
+                }
+                fwrite(&record, sizeof(record), 1, journal);
+            }
+        }
+
+        fclose(journal);
+        closeTextScanner(&scanner);
+    }
+
+    int replayRatingJournal(CompanyTable *companies) {
+        for (int i = 0; i < companies->count; i++) {
+            memset(&companyAt(companies, i)->ratings, 0, sizeof(RatingAggregate));
+        }
+
+        if (access(JOURNAL_FILE, F_OK) != 0) {
+            convertLegacyRatings(companies);
+        }
+
+        int fd = open(JOURNAL_FILE, O_RDONLY);
+        struct stat st;
+
+        if (fd < 0) {
+            return 0;
+        }
+        if (fstat(fd, &st) != 0 || (size_t) st.st_size <= sizeof(JournalHeader)) {
+            close(fd);
+            return 0;
+        }
+
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            printf("Error mapping %s.\n", JOURNAL_FILE);
+            return 0;
+        }
+
+        const JournalHeader *header = map;
+        int replayed = 0;
+
+        if (isValidJournalHeader(header)) {
+            const RatingRecord *records = (const RatingRecord *) (header + 1);
+            size_t numRecords = (st.st_size - sizeof(JournalHeader)) / sizeof(RatingRecord);
+
+            // Records are replayed in arrival order, so a removal only cancels the votes before it.
+            for (size_t r = 0; r < numRecords; r++) {
+                Company *company = findCompanyByNif(companies, records[r].nif);
+
+                if (company == NULL) {
+                    continue;
+                }
+                if (isRemovalRecord(&records[r])) {
+                    memset(&company->ratings, 0, sizeof(RatingAggregate));
+                } else {
+                    addRating(&company->ratings, records[r].value);
+                    replayed++;
+                }
+            }
+        } else {
+            printf("Invalid or unsupported %s.\n", JOURNAL_FILE);
+        }
+
+        munmap(map, st.st_size);
+        return replayed;
+    }
+
+    int loadCompanyRatings(int nif, float ratings[], int maxRatings) {
+        int fd = open(JOURNAL_FILE, O_RDONLY);
+        struct stat st;
+
+        if (fd < 0) {
+            return 0;
+        }
+        if (fstat(fd, &st) != 0 || (size_t) st.st_size <= sizeof(JournalHeader)) {
+            close(fd);
+            return 0;
+        }
+
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            printf("Error mapping %s.\n", JOURNAL_FILE);
+            return 0;
+        }
+
+        const JournalHeader *header = map;
+        const RatingRecord *records = (const RatingRecord *) (header + 1);
+        size_t numRecords = (st.st_size - sizeof(JournalHeader)) / sizeof(RatingRecord);
+        size_t sorted = header->sortedRecords < numRecords ? header->sortedRecords : numRecords;
+        int count = 0;
+
+        if (isValidJournalHeader(header)) {
+            // The compacted part is grouped by NIF: find the first vote of the company.
+            size_t low = 0;
+            size_t high = sorted;
+            while (low < high) {
+                size_t middle = low + (high - low) / 2;
+                if (records[middle].nif < nif) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            for (size_t r = low; r < sorted && records[r].nif == nif && count < maxRatings; r++) {
+                ratings[count++] = records[r].value;
+            }
+
+            // Votes appended since then are in arrival order; a removal drops the votes read so far.
+            for (size_t r = sorted; r < numRecords; r++) {
+                if (records[r].nif != nif) {
+                    continue;
+                }
+                if (isRemovalRecord(&records[r])) {
+                    count = 0;
+                } else if (count < maxRatings) {
+                    ratings[count++] = records[r].value;
+                }
+            }
+        }
+
+        munmap(map, st.st_size);
+        return count;
+    }
+
+    /*
+     * Copies the votes appended after the compaction snapshot into the compacted journal.
+     * Must be called with the journal lock held.
+     */
+    static int copyJournalTail(FILE *compacted, off_t from) {
+        int fd = open(JOURNAL_FILE, O_RDONLY);
+        struct stat st;
+        char buffer[4096];
+        int ok = fd >= 0 && fstat(fd, &st) == 0;
+
+        if (ok) {
+            off_t end = from + (st.st_size - from) / (off_t) sizeof(RatingRecord) * (off_t) sizeof(RatingRecord);
+
+            while (ok && from < end) {
+                size_t chunk = end - from < (off_t) sizeof(buffer) ? (size_t) (end - from) : sizeof(buffer);
+                ok = pread(fd, buffer, chunk, from) == (ssize_t) chunk && fwrite(buffer, 1, chunk, compacted) == chunk;
+                from += chunk;
+            }
+        }
+
+        if (fd >= 0) {
+            close(fd);
+        }
+        return ok;
+    }
+
+    static void *compactRatingJournal(void *arg) {
+        int32_t *nifs = arg;
+        int numNifs = nifs[0];
+        int32_t *liveNifs = nifs + 1;
+        int fd = open(JOURNAL_FILE, O_RDONLY);
+        struct stat st;
+        JournalHeader header;
+
+        if (fd < 0 || fstat(fd, &st) != 0 || read(fd, &header, sizeof(header)) != sizeof(header) ||
+                !isValidJournalHeader(&header)) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            free(nifs);
+            return NULL;
+        }
+
+        size_t numRecords = (st.st_size - sizeof(JournalHeader)) / sizeof(RatingRecord);
+        off_t snapshotEnd = sizeof(JournalHeader) + numRecords * sizeof(RatingRecord);
+        RatingRecord *records = malloc((numRecords + 1) * sizeof(RatingRecord));
+        JournalEntry *entries = malloc((numRecords + 1) * sizeof(JournalEntry));
+        size_t numEntries = 0;
+        size_t kept = 0;
+
+        if (records == NULL || entries == NULL ||
+                pread(fd, records, numRecords * sizeof(RatingRecord), sizeof(JournalHeader)) !=
+                (ssize_t) (numRecords * sizeof(RatingRecord))) {
+            close(fd);
+            free(entries);
+            free(records);
+            free(nifs);
+            return NULL;
+        }
+        close(fd);
+
+        for (size_t r = 0; r < numRecords; r++) {
+            if (bsearch(&records[r].nif, liveNifs, numNifs, sizeof(int32_t), compareNifs) != NULL) {
+                entries[numEntries].record = records[r];
+                entries[numEntries].position = r;
+                numEntries++;
+            }
+        }
+
+        qsort(entries, numEntries, sizeof(JournalEntry), compareJournalEntries);
+
+        // Within each NIF, keep only the votes that arrived after its last removal.
+        for (size_t first = 0, end; first < numEntries; first = end) {
+            size_t lastRemoval = 0;
+            int removed = 0;
+
+            for (end = first; end < numEntries && entries[end].record.nif == entries[first].record.nif; end++) {
+                if (isRemovalRecord(&entries[end].record) && (!removed || entries[end].position > lastRemoval)) {
+                    lastRemoval = entries[end].position;
+                    removed = 1;
+                }
+            }
+            for (size_t e = first; e < end; e++) {
+                if (!removed || entries[e].position > lastRemoval) {
+                    records[kept++] = entries[e].record;
+                }
+            }
+        }
+        free(entries);
+
+        // Nothing to drop and already grouped: leave the journal alone.
+        if (kept == numRecords && header.sortedRecords == numRecords) {
+            free(records);
+            free(nifs);
+            return NULL;
+        }
+
+        char tempPath[] = JOURNAL_FILE ".tmp";
+        FILE *compacted = fopen(tempPath, "wb");
+        header.sortedRecords = kept;
+        int ok = compacted != NULL && fwrite(&header, sizeof(header), 1, compacted) == 1 &&
+                fwrite(records, sizeof(RatingRecord), kept, compacted) == kept;
+
+        pthread_mutex_lock(&journalLock);
+        ok = ok && copyJournalTail(compacted, snapshotEnd);
+        if (compacted != NULL) {
+            ok = fclose(compacted) == 0 && ok;
+        }
+        if (ok && rename(tempPath, JOURNAL_FILE) == 0) {
+            if (journalFd >= 0) {
+                close(journalFd);
+                journalFd = -1;
+            }
+        } else {
+            remove(tempPath);
+        }
+        pthread_mutex_unlock(&journalLock);
+
+        free(records);
+        free(nifs);
+        return NULL;
+    }
+
+    void startRatingJournalCompaction(const CompanyTable *companies) {
+        if (compactionRunning) {
+            return;
+        }
+
+        // The thread gets its own sorted copy of the live NIFs; the count goes in front.
+        int32_t *nifs = malloc((companies->count + 1) * sizeof(int32_t));
+        if (nifs == NULL) {
+            return;
+        }
+
+        nifs[0] = companies->count;
+        for (int i = 0; i < companies->count; i++) {
+            nifs[i + 1] = companyAt(companies, i)->nif;
+        }
+        qsort(nifs + 1, companies->count, sizeof(int32_t), compareNifs);
+
+        if (pthread_create(&compactionThread, NULL, compactRatingJournal, nifs) == 0) {
+            compactionRunning = 1;
+        } else {
+            free(nifs);
+        }
+    }
+
+    void closeRatingJournal() {
+        if (compactionRunning) {
+            pthread_join(compactionThread, NULL);
+            compactionRunning = 0;
+        }
+
+        pthread_mutex_lock(&journalLock);
+        if (journalFd >= 0) {
+            close(journalFd);
+            journalFd = -1;
+        }
+        pthread_mutex_unlock(&journalLock);
+    }
@@ -0,0 +1,134 @@
+/**
+ * @file journal.h
+ * @brief Header file for the append-only rating journal of the Company Management System.
+ *
+ * Every accepted vote is appended to ratings.journal as one fixed-size record, so saving a
+ * vote costs the same no matter how many ratings the catalog holds. At startup the journal is
+ * replayed into the companies and then compacted by a background thread, which drops the votes
+ * of removed companies and groups the remaining ones by NIF.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdint.h>
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Name of the rating journal.
+     */
+    #define JOURNAL_FILE "ratings.journal"
+
+    /**
+     * @brief Name of the legacy ratings file converted into the journal.
+     */
+    #define JOURNAL_LEGACY_FILE "ratings.txt"
+
+    /**
+     * @brief Magic number at the start of the journal ("RJ01").
+     */
+    #define JOURNAL_MAGIC 0x31304a52u
+
+    /**
+     * @brief Current version of the journal layout.
+     */
+    #define JOURNAL_VERSION 1
+
+    /**
+     * @brief Value of a removal record: it cancels every earlier vote of its NIF.
+     */
+    #define JOURNAL_REMOVAL_VALUE -1.0f
+
+    /**
+     * @brief Header at the start of the journal.
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t sortedRecords;  // leading records sorted by NIF by the last compaction
+    } JournalHeader;
+
+    /**
+     * @brief One vote, as stored in the journal.
+     */
+    typedef struct {
+        int32_t nif;
+        float value;
+        int64_t timestamp;
+    } RatingRecord;
+
+    /**
+     * @brief Appends one vote to the rating journal.
+     *
+     * @param nif The NIF of the rated company.
+     * @param value The rating given.
+     * @return 1 on success, 0 on failure.
+     */
+    int appendRatingToJournal(int nif, float value);
+
+    /**
+     * @brief Appends a removal record for a company to the rating journal.
+     *
+     * The votes given before it are no longer counted, so a company created later with the
+     * same NIF starts without ratings.
+     *
+     * @param nif The NIF of the removed company.
+     * @return 1 on success, 0 on failure.
+     */
+    int appendRemovalToJournal(int nif);
+
+    /**
+     * @brief Replays the rating journal into the company table.
+     *
+     * Only the number of ratings and the average of each company are kept in the table.
+     * They are reset first, so replaying twice gives the same result. If there is no journal yet, the legacy ratings.txt file is converted first.
+     *
+     * @param companies The company table.
+     * @return The number of votes replayed.
+     */
+    int replayRatingJournal(CompanyTable* companies);
+
+    /**
+     * @brief Reads the rating history of one company from the journal.
+     *
+     * The history is not kept in memory; it is read only when a report needs it.
+     *
+     * @param nif The NIF of the company.
+     * @param ratings An array receiving the ratings.
+     * @param maxRatings The capacity of the array.
+     * @return The number of ratings read.
+     */
+    int loadCompanyRatings(int nif, float ratings[], int maxRatings);
+
+    /**
+     * @brief Starts compacting the rating journal in a background thread.
+     *
+     * Votes for NIFs that are not in the table are dropped, as are removal records and the votes
+     * they cancel, and the rest are grouped by NIF.
+     * Votes appended while the compaction runs are carried over to the compacted journal.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void startRatingJournalCompaction(const CompanyTable* companies);
+
+    /**
+     * @brief Waits for a running compaction and closes the rating journal.
+     *
+     * @return void - This function does not return a value.
+     */
+    void closeRatingJournal();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JOURNAL_H */
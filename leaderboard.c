@@ -0,0 +1,285 @@
+/**
+ * @file leaderboard.c
+ * @brief source file for the leaderboards of the best rated companies of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "leaderboard.h"
+#include "companytable.h"
+
+/**
+ * @brief The leaderboard over all the companies and the leaderboards of each business sector.
+ */
+static Leaderboard overall;
+static Leaderboard* sectorBoards;
+static int numSectorBoards;
+
+/**
+ * @brief State of the generator of node levels.
+ */
+static uint32_t levelSeed = 2463534242u;
+
+    static int randomLevel() {
+        int level = 1;
+
+        // Each level holds about a quarter of the nodes of the level below.
+        levelSeed ^= levelSeed << 13;
+        levelSeed ^= levelSeed >> 17;
+        levelSeed ^= levelSeed << 5;
+        for (uint32_t bits = levelSeed; (bits & 3) == 0 && level < LEADERBOARD_MAX_LEVEL; bits >>= 2) {
+            level++;
+        }
+        return level;
+    }
+
+    static LeaderboardNode *createNode(int level) {
+        LeaderboardNode *node = calloc(1, sizeof(LeaderboardNode) + level * sizeof(LeaderboardLink));
+
+        if (node == NULL) {
+            printf("Memory allocation error.\n");
+            return NULL;
+        }
+        node->level = level;
+        return node;
+    }
+
+    static int initLeaderboard(Leaderboard *board) {
+        if (board->head == NULL) {
+            board->head = createNode(LEADERBOARD_MAX_LEVEL);
+            board->level = 1;
+            board->count = 0;
+        }
+        return board->head != NULL;
+    }
+
+    /*
+     * Checks whether the node ranks before a key: higher average, then more ratings, then lower NIF.
+     */
+    static int ranksBefore(const LeaderboardNode *node, float average, int count, int nif) {
+        if (node->average != average) {
+            return node->average > average;
+        }
+        if (node->count != count) {
+            return node->count > count;
+        }
+        return node->nif < nif;
+    }
+
+    static Leaderboard *sectorBoard(int sectorId, int create) {
+        if (sectorId < 0) {
+            return NULL;
+        }
+
+        if (sectorId >= numSectorBoards) {
+            if (!create) {
+                return NULL;
+            }
+
+            int capacity = numSectorBoards > 0 ? numSectorBoards : INITIAL_BUFFER_SIZE;
+            while (capacity <= sectorId) {
+                capacity *= 2;
+            }
+
+            Leaderboard *boards = realloc(sectorBoards, capacity * sizeof(Leaderboard));
+            if (boards == NULL) {
+                printf("Memory allocation error.\n");
+                return NULL;
+            }
+            memset(&boards[numSectorBoards], 0, (capacity - numSectorBoards) * sizeof(Leaderboard));
+            sectorBoards = boards;
+            numSectorBoards = capacity;
+        }
+        return &sectorBoards[sectorId];
+    }
+
+    static void insertNode(Leaderboard *board, Company *company, float average) {
+        LeaderboardNode *update[LEADERBOARD_MAX_LEVEL];
+        int rank[LEADERBOARD_MAX_LEVEL];
+        LeaderboardNode *x;
+
+        if (!initLeaderboard(board)) {
+            return;
+        }
+
+        x = board->head;
+        for (int i = board->level - 1; i >= 0; i--) {
+            rank[i] = i == board->level - 1 ? 0 : rank[i + 1];
+            while (x->links[i].next != NULL &&
+                    ranksBefore(x->links[i].next, average, company->ratings.count, company->nif)) {
+                rank[i] += x->links[i].span;
+                x = x->links[i].next;
+            }
+            update[i] = x;
+        }
+
+        int level = randomLevel();
+        if (level > board->level) {
+            for (int i = board->level; i < level; i++) {
+                rank[i] = 0;
+                update[i] = board->head;
+                update[i]->links[i].span = board->count;
+            }
+            board->level = level;
+        }
+
+        LeaderboardNode *node = createNode(level);
+        if (node == NULL) {
+            return;
+        }
+        node->company = company;
+        node->average = average;
+        node->count = company->ratings.count;
+        node->nif = company->nif;
+
+        for (int i = 0; i < level; i++) {
+            node->links[i].next = update[i]->links[i].next;
+            update[i]->links[i].next = node;
+
+            node->links[i].span = update[i]->links[i].span - (rank[0] - rank[i]);
+            update[i]->links[i].span = rank[0] - rank[i] + 1;
+        }
+        for (int i = level; i < board->level; i++) {
+            update[i]->links[i].span++;
+        }
+        board->count++;
+    }
+
+    static void deleteNode(Leaderboard *board, const Company *company, float average) {
+        LeaderboardNode *update[LEADERBOARD_MAX_LEVEL];
+        LeaderboardNode *x = board->head;
+
+        if (x == NULL) {
+            return;
+        }
+
+        for (int i = board->level - 1; i >= 0; i--) {
+            while (x->links[i].next != NULL &&
+                    ranksBefore(x->links[i].next, average, company->ratings.count, company->nif)) {
+                x = x->links[i].next;
+            }
+            update[i] = x;
+        }
+
+        x = x->links[0].next;
+        if (x == NULL || x->company != company) {
+            return;
+        }
+
+        for (int i = 0; i < board->level; i++) {
+            if (update[i]->links[i].next == x) {
+                update[i]->links[i].span += x->links[i].span - 1;
+                update[i]->links[i].next = x->links[i].next;
+            } else {
+                update[i]->links[i].span--;
+            }
+        }
+        while (board->level > 1 && board->head->links[board->level - 1].next == NULL) {
+            board->level--;
+        }
+        board->count--;
+        free(x);
+    }
+
+    static int nodeRank(const Leaderboard *board, const Company *company, float average) {
+        const LeaderboardNode *x = board->head;
+        int rank = 0;
+
+        if (x == NULL) {
+            return 0;
+        }
+
+        for (int i = board->level - 1; i >= 0; i--) {
+            while (x->links[i].next != NULL &&
+                    ranksBefore(x->links[i].next, average, company->ratings.count, company->nif)) {
+                rank += x->links[i].span;
+                x = x->links[i].next;
+            }
+        }
+
+        x = x->links[0].next;
+        return x != NULL && x->company == company ? rank + 1 : 0;
+    }
+
+    static void freeLeaderboard(Leaderboard *board) {
+        LeaderboardNode *node = board->head;
+
+        while (node != NULL) {
+            LeaderboardNode *next = node->links[0].next;
+            free(node);
+            node = next;
+        }
+        memset(board, 0, sizeof(Leaderboard));
+    }
+
+    void buildLeaderboards(const CompanyTable *companies) {
+        freeLeaderboards();
+
+        for (int i = 0; i < companies->count; i++) {
+            rankCompany(companyAt(companies, i));
+        }
+    }
+
+    void rankCompany(Company *company) {
+        if (!company->active || company->ratings.count == 0) {
+            return;
+        }
+
+        float average = calculateAverageRating(&company->ratings);
+        Leaderboard *board = sectorBoard(company->sectorId, 1);
+
+        insertNode(&overall, company, average);
+        if (board != NULL) {
+            insertNode(board, company, average);
+        }
+    }
+
+    void unrankCompany(const Company *company) {
+        if (company->ratings.count == 0) {
+            return;
+        }
+
+        float average = calculateAverageRating(&company->ratings);
+        Leaderboard *board = sectorBoard(company->sectorId, 0);
+
+        deleteNode(&overall, company, average);
+        if (board != NULL) {
+            deleteNode(board, company, average);
+        }
+    }
+
+    int getTopCompanies(int sectorId, int maxResults, Company *results[]) {
+        const Leaderboard *board = sectorId < 0 ? &overall : sectorBoard(sectorId, 0);
+        int found = 0;
+
+        if (board == NULL || board->head == NULL) {
+            return 0;
+        }
+
+        for (const LeaderboardNode *node = board->head->links[0].next; node != NULL && found < maxResults;
+                node = node->links[0].next) {
+            results[found++] = node->company;
+        }
+        return found;
+    }
+
+    int getCompanyRank(const Company *company, int sectorId) {
+        const Leaderboard *board = sectorId < 0 ? &overall : sectorBoard(sectorId, 0);
+
+        if (board == NULL || company->ratings.count == 0) {
+            return 0;
+        }
+        return nodeRank(board, company, calculateAverageRating(&company->ratings));
+    }
+
+    void freeLeaderboards() {
+        freeLeaderboard(&overall);
+        for (int i = 0; i < numSectorBoards; i++) {
+            freeLeaderboard(&sectorBoards[i]);
+        }
+        free(sectorBoards);
+        sectorBoards = NULL;
+        numSectorBoards = 0;
+    }
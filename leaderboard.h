@@ -0,0 +1,120 @@
+/**
+ * @file leaderboard.h
+ * @brief Header file for the leaderboards of the best rated companies of the Company Management System.
+ *
+ * The active companies with at least one rating are kept in an indexable skiplist ordered by
+ * average rating, then by number of ratings, then by NIF. Each link also records how many
+ * companies it skips, so the rank of a company is found on the way down to it. There is one
+ * leaderboard over all the companies and one per business sector.
+ *
+ * Inserting, removing and finding the rank of a company take O(log n) on average, and the top N
+ * companies are the first N nodes. The leaderboards are built once the catalog is loaded; a
+ * company is removed before its rating, business sector or status changes and inserted again
+ * afterwards.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Maximum number of levels of a leaderboard.
+     */
+    #define LEADERBOARD_MAX_LEVEL 24
+
+    struct LeaderboardNode;
+
+    /**
+     * @brief Link from a node to the next node of one level.
+     */
+    typedef struct {
+        struct LeaderboardNode* next;
+        int span;  // number of level 0 steps the link covers
+    } LeaderboardLink;
+
+    /**
+     * @brief One ranked company.
+     */
+    typedef struct LeaderboardNode {
+        Company* company;
+        float average;  // the key the company was ranked with
+        int count;
+        int nif;
+        int level;
+        LeaderboardLink links[];
+    } LeaderboardNode;
+
+    /**
+     * @brief Structure representing a leaderboard.
+     */
+    typedef struct {
+        LeaderboardNode* head;
+        int level;
+        int count;
+    } Leaderboard;
+
+    /**
+     * @brief Builds the leaderboards from every company of the table.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void buildLeaderboards(const CompanyTable* companies);
+
+    /**
+     * @brief Inserts a company in the leaderboards, if it is active and has been rated.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void rankCompany(Company* company);
+
+    /**
+     * @brief Removes a company from the leaderboards.
+     *
+     * Must be called before the ratings or the business sector of the company change.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void unrankCompany(const Company* company);
+
+    /**
+     * @brief Gets the best rated companies.
+     *
+     * @param sectorId The id of a business sector in sectorSymbols, or -1 for all the companies.
+     * @param maxResults The capacity of the results array.
+     * @param results An array receiving the companies, best first.
+     * @return The number of companies written to the array.
+     */
+    int getTopCompanies(int sectorId, int maxResults, Company* results[]);
+
+    /**
+     * @brief Gets the rank of a company.
+     *
+     * @param company The company.
+     * @param sectorId The id of its business sector, or -1 for the rank among all the companies.
+     * @return The rank, starting at 1, or 0 if the company is not ranked.
+     */
+    int getCompanyRank(const Company* company, int sectorId);
+
+    /**
+     * @brief Frees the memory of the leaderboards.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freeLeaderboards();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEADERBOARD_H */
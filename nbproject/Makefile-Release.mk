@@ -36,8 +36,28 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 # Object Files
 OBJECTFILES= \
 	${OBJECTDIR}/adm.o \
+	${OBJECTDIR}/autocomplete.o \
+	${OBJECTDIR}/bitmap.o \
+	${OBJECTDIR}/commentlog.o \
+	${OBJECTDIR}/commentsearch.o \
+	${OBJECTDIR}/companytable.o \
+	${OBJECTDIR}/csvimport.o \
+	${OBJECTDIR}/facet.o \
+	${OBJECTDIR}/fuzzy.o \
+	${OBJECTDIR}/journal.o \
+	${OBJECTDIR}/leaderboard.o \
 	${OBJECTDIR}/main.o \
+	${OBJECTDIR}/postalindex.o \
+	${OBJECTDIR}/postings.o \
+	${OBJECTDIR}/query.o \
 	${OBJECTDIR}/report.o \
+	${OBJECTDIR}/resultcursor.o \
+	${OBJECTDIR}/snapshot.o \
+	${OBJECTDIR}/store.o \
+	${OBJECTDIR}/symbols.o \
+	${OBJECTDIR}/textcolumn.o \
+	${OBJECTDIR}/textscan.o \
+	${OBJECTDIR}/trigram.o \
 	${OBJECTDIR}/user.o \
 	${OBJECTDIR}/utilities.o
 
@@ -56,7 +76,7 @@ FFLAGS=
 ASFLAGS=
 
 # Link Libraries and Options
-LDLIBSOPTIONS=
+LDLIBSOPTIONS=-lpthread -lm
 
 # Build Targets
 .build-conf: ${BUILD_SUBPROJECTS}
@@ -71,16 +91,116 @@ ${OBJECTDIR}/adm.o: adm.c
 	${RM} "$@.d"
 	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/adm.o adm.c
 
+${OBJECTDIR}/autocomplete.o: autocomplete.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/autocomplete.o autocomplete.c
+
+${OBJECTDIR}/bitmap.o: bitmap.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/bitmap.o bitmap.c
+
+${OBJECTDIR}/commentlog.o: commentlog.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/commentlog.o commentlog.c
+
+${OBJECTDIR}/commentsearch.o: commentsearch.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/commentsearch.o commentsearch.c
+
+${OBJECTDIR}/companytable.o: companytable.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/companytable.o companytable.c
+
+${OBJECTDIR}/csvimport.o: csvimport.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/csvimport.o csvimport.c
+
+${OBJECTDIR}/facet.o: facet.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/facet.o facet.c
+
+${OBJECTDIR}/fuzzy.o: fuzzy.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/fuzzy.o fuzzy.c
+
+${OBJECTDIR}/journal.o: journal.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/journal.o journal.c
+
+${OBJECTDIR}/leaderboard.o: leaderboard.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/leaderboard.o leaderboard.c
+
 ${OBJECTDIR}/main.o: main.c
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/main.o main.c
 
+${OBJECTDIR}/postalindex.o: postalindex.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/postalindex.o postalindex.c
+
+${OBJECTDIR}/postings.o: postings.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/postings.o postings.c
+
+${OBJECTDIR}/query.o: query.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/query.o query.c
+
 ${OBJECTDIR}/report.o: report.c
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/report.o report.c
 
+${OBJECTDIR}/resultcursor.o: resultcursor.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/resultcursor.o resultcursor.c
+
+${OBJECTDIR}/snapshot.o: snapshot.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/snapshot.o snapshot.c
+
+${OBJECTDIR}/store.o: store.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/store.o store.c
+
+${OBJECTDIR}/symbols.o: symbols.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/symbols.o symbols.c
+
+${OBJECTDIR}/textcolumn.o: textcolumn.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/textcolumn.o textcolumn.c
+
+${OBJECTDIR}/textscan.o: textscan.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/textscan.o textscan.c
+
+${OBJECTDIR}/trigram.o: trigram.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -O2 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/trigram.o trigram.c
+
 ${OBJECTDIR}/user.o: user.c
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -0,0 +1,189 @@
+/**
+ * @file postalindex.c
+ * @brief source file for the postal code index of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <ctype.h>
+#include "postalindex.h"
+#include "companytable.h"
+
+/**
+ * @brief Number of digits of a packed postal code.
+ */
+#define POSTAL_CODE_DIGITS 7
+
+/**
+ * @brief The index, sorted by postal code and then by slot.
+ */
+static PostalCodeEntry *entries = NULL;
+static int numEntries = 0;
+static int entriesCapacity = 0;
+
+    static int compareEntries(const void *a, const void *b) {
+        const PostalCodeEntry *x = a;
+        const PostalCodeEntry *y = b;
+
+        if (x->code != y->code) {
+            return x->code < y->code ? -1 : 1;
+        }
+        return (x->slot > y->slot) - (x->slot < y->slot);
+    }
+
+    /*
+     * Position of the first entry not before (code, slot).
+     */
+    static int lowerBound(int code, int slot) {
+        PostalCodeEntry key = {code, slot};
+        int low = 0;
+        int high = numEntries;
+
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (compareEntries(&entries[middle], &key) < 0) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    static int reserveEntries(int count) {
+        if (count <= entriesCapacity) {
+            return 1;
+        }
+
+        int capacity = entriesCapacity > 0 ? entriesCapacity : INITIAL_BUFFER_SIZE;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+
+        PostalCodeEntry *grown = realloc(entries, capacity * sizeof(PostalCodeEntry));
+        if (grown == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        entries = grown;
+        entriesCapacity = capacity;
+        return 1;
+    }
+
+    void buildPostalCodeIndex(const CompanyTable *companies) {
+        freePostalCodeIndex();
+        if (!reserveEntries(companies->count)) {
+            return;
+        }
+
+        // Sorting once is cheaper than inserting every company in order.
+        for (int i = 0; i < companies->count; i++) {
+            const Company *company = companyAt(companies, i);
+
+            if (company->postalCodeValue >= 0) {
+                entries[numEntries].code = company->postalCodeValue;
+                entries[numEntries].slot = company->tableSlot;
+                numEntries++;
+            }
+        }
+        qsort(entries, numEntries, sizeof(PostalCodeEntry), compareEntries);
+    }
+
+    void indexCompanyPostalCode(const Company *company) {
+        if (company->postalCodeValue < 0 || !reserveEntries(numEntries + 1)) {
+            return;
+        }
+
+        int position = lowerBound(company->postalCodeValue, company->tableSlot);
+        memmove(&entries[position + 1], &entries[position], (numEntries - position) * sizeof(PostalCodeEntry));
+        entries[position].code = company->postalCodeValue;
+        entries[position].slot = company->tableSlot;
+        numEntries++;
+    }
+
+    void unindexCompanyPostalCode(const Company *company) {
+        int position = lowerBound(company->postalCodeValue, company->tableSlot);
+
+        if (company->postalCodeValue < 0 || position == numEntries || entries[position].slot != company->tableSlot ||
+                entries[position].code != company->postalCodeValue) {
+            return;
+        }
+
+        memmove(&entries[position], &entries[position + 1], (numEntries - position - 1) * sizeof(PostalCodeEntry));
+        numEntries--;
+    }
+
+    /*
+     * Reads the first digits of a postal code, with the dash after the fourth digit optional,
+     * and gives the smallest and largest postal codes starting with them.
+     */
+    static int parsePostalCodePrefix(const char *text, size_t length, int *low, int *high) {
+        int value = 0;
+        int digits = 0;
+        int scale = 1;
+
+        for (size_t i = 0; i < length; i++) {
+            if (text[i] == '-' && i == 4 && digits == 4) {
+                continue;
+            }
+            if (!isdigit((unsigned char) text[i]) || digits == POSTAL_CODE_DIGITS) {
+                return 0;
+            }
+            value = value * 10 + (text[i] - '0');
+            digits++;
+        }
+        if (digits == 0) {
+            return 0;
+        }
+
+        for (int i = digits; i < POSTAL_CODE_DIGITS; i++) {
+            scale *= 10;
+        }
+        *low = value * scale;
+        *high = (value + 1) * scale - 1;
+        return 1;
+    }
+
+    int parsePostalCodeRange(const char *text, int *low, int *high) {
+        const char *separator = strchr(text, ':');
+        int ignored;
+
+        if (separator == NULL) {
+            return parsePostalCodePrefix(text, strlen(text), low, high);
+        }
+        return parsePostalCodePrefix(text, separator - text, low, &ignored) &&
+                parsePostalCodePrefix(separator + 1, strlen(separator + 1), &ignored, high) && *low <= *high;
+    }
+
+    int countCompanyPostalCodes(int low, int high) {
+        return high < low ? 0 : lowerBound(high + 1, -1) - lowerBound(low, -1);
+    }
+
+    int searchCompanyPostalCodes(const CompanyTable *companies, int low, int high, Company ***results) {
+        int first = lowerBound(low, -1);
+        int last = first + countCompanyPostalCodes(low, high);
+        int found = 0;
+
+        *results = malloc((last - first + 1) * sizeof(Company *));
+        if (*results == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        for (int i = first; i < last; i++) {
+            Company *company = companyBySlot(companies, entries[i].slot);
+            if (company != NULL) {
+                (*results)[found++] = company;
+            }
+        }
+        return found;
+    }
+
+    void freePostalCodeIndex() {
+        free(entries);
+        entries = NULL;
+        numEntries = 0;
+        entriesCapacity = 0;
+    }
@@ -0,0 +1,103 @@
+/**
+ * @file postalindex.h
+ * @brief Header file for the postal code index of the Company Management System.
+ *
+ * Postal codes are packed into integers with encodePostalCode, which keeps their order, and the
+ * index is an array of (packed postal code, table slot) pairs kept sorted. A region such as
+ * 4700-xxx is the range 4700000 to 4700999, so both prefix and range queries are one binary
+ * search for the first pair followed by a walk over the k matching pairs, O(log n + k).
+ *
+ * Companies whose postal code is not valid are not indexed.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef POSTALINDEX_H
+#define POSTALINDEX_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief One company in the postal code index.
+     */
+    typedef struct {
+        int code;  // the packed postal code
+        int slot;  // the table slot of the company
+    } PostalCodeEntry;
+
+    /**
+     * @brief Builds the index from every company of the table.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void buildPostalCodeIndex(const CompanyTable* companies);
+
+    /**
+     * @brief Adds the postal code of a company to the index.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void indexCompanyPostalCode(const Company* company);
+
+    /**
+     * @brief Removes the postal code of a company from the index.
+     *
+     * Must be called before the postal code is changed, or before the company is removed.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void unindexCompanyPostalCode(const Company* company);
+
+    /**
+     * @brief Reads a postal code region or range typed by the user.
+     *
+     * A region is the first digits of the postal codes, such as "4700" or "4700-1". A range is
+     * two regions or postal codes separated by ':', such as "4700:4799" or "4700-000:4715-999".
+     *
+     * @param text The text typed.
+     * @param low Receives the smallest packed postal code of the range.
+     * @param high Receives the largest packed postal code of the range.
+     * @return 1 on success, 0 if the text is not a region or a range.
+     */
+    int parsePostalCodeRange(const char* text, int* low, int* high);
+
+    /**
+     * @brief Finds the companies whose postal code is within a range.
+     *
+     * @param companies The company table.
+     * @param low The smallest packed postal code.
+     * @param high The largest packed postal code.
+     * @param results Receives an array with the matching companies by postal code, to be freed by the caller.
+     * @return The number of matching companies, or -1 on failure.
+     */
+    int searchCompanyPostalCodes(const CompanyTable* companies, int low, int high, Company*** results);
+
+    /**
+     * @brief Counts the companies whose postal code is within a range, in O(log n).
+     *
+     * @param low The smallest packed postal code.
+     * @param high The largest packed postal code.
+     * @return The number of companies.
+     */
+    int countCompanyPostalCodes(int low, int high);
+
+    /**
+     * @brief Frees the memory of the index.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freePostalCodeIndex();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POSTALINDEX_H */
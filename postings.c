@@ -0,0 +1,113 @@
+/**
+ * @file postings.c
+ * @brief source file for the posting lists used by the search indexes of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "postings.h"
+
+    static int compareSlots(const void *a, const void *b) {
+        int x = *(const int *) a;
+        int y = *(const int *) b;
+        return (x > y) - (x < y);
+    }
+
+    void addPosting(PostingList *postings, int slot) {
+        // A key repeated for the same company was just added for this slot.
+        if (postings->count > 0 && postings->slots[postings->count - 1] == slot) {
+            return;
+        }
+
+        if (postings->count == postings->capacity) {
+            int capacity = postings->capacity > 0 ? postings->capacity * 2 : 4;
+            int *slots = realloc(postings->slots, capacity * sizeof(int));
+            if (slots == NULL) {
+                printf("Memory allocation error.\n");
+                return;
+            }
+            postings->slots = slots;
+            postings->capacity = capacity;
+        }
+
+        if (postings->count == 0) {
+            postings->sorted = 1;
+        } else if (postings->slots[postings->count - 1] > slot) {
+            postings->sorted = 0;
+        }
+        postings->slots[postings->count++] = slot;
+    }
+
+    void sortPostings(PostingList *postings) {
+        if (!postings->sorted) {
+            qsort(postings->slots, postings->count, sizeof(int), compareSlots);
+            postings->sorted = 1;
+        }
+    }
+
+    void removePosting(PostingList *postings, int slot) {
+        int position = -1;
+
+        if (postings->sorted) {
+            int *found = bsearch(&slot, postings->slots, postings->count, sizeof(int), compareSlots);
+            position = found != NULL ? (int) (found - postings->slots) : -1;
+        } else {
+            for (int i = 0; i < postings->count && position < 0; i++) {
+                if (postings->slots[i] == slot) {
+                    position = i;
+                }
+            }
+        }
+
+        if (position >= 0) {
+            memmove(&postings->slots[position], &postings->slots[position + 1],
+                    (postings->count - position - 1) * sizeof(int));
+            postings->count--;
+        }
+    }
+
+    int intersectPostings(PostingList *lists[], int numLists, int **slots) {
+        int shortest = 0;
+
+        *slots = NULL;
+        for (int i = 1; i < numLists; i++) {
+            if (lists[i]->count < lists[shortest]->count) {
+                shortest = i;
+            }
+        }
+
+        int count = lists[shortest]->count;
+        int *result = malloc((count + 1) * sizeof(int));
+        if (result == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        sortPostings(lists[shortest]);
+        memcpy(result, lists[shortest]->slots, count * sizeof(int));
+
+        for (int i = 0; i < numLists && count > 0; i++) {
+            if (lists[i] == lists[shortest]) {
+                continue;
+            }
+            sortPostings(lists[i]);
+
+            int kept = 0;
+            for (int c = 0; c < count; c++) {
+                if (bsearch(&result[c], lists[i]->slots, lists[i]->count, sizeof(int), compareSlots) != NULL) {
+                    result[kept++] = result[c];
+                }
+            }
+            count = kept;
+        }
+
+        *slots = result;
+        return count;
+    }
+
+    void freePostings(PostingList *postings) {
+        free(postings->slots);
+        memset(postings, 0, sizeof(PostingList));
+    }
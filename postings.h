@@ -0,0 +1,81 @@
+/**
+ * @file postings.h
+ * @brief Header file for the posting lists used by the search indexes of the Company Management System.
+ *
+ * A posting list holds the table slots of the companies that share one key, such as a trigram
+ * or a category. Slots are mostly appended in increasing order; a list that received one out of
+ * order is sorted again before it is next searched. Queries combining several keys intersect
+ * the lists, starting from the shortest one.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef POSTINGS_H
+#define POSTINGS_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Slots of the companies sharing one key.
+     */
+    typedef struct {
+        int* slots;
+        int count;
+        int capacity;
+        int sorted;  // 0 when a slot was appended out of order; sorted again before the next query
+    } PostingList;
+
+    /**
+     * @brief Adds a slot to a posting list, unless it was the last one added.
+     *
+     * @param postings The posting list.
+     * @param slot The table slot of the company.
+     * @return void - This function does not return a value.
+     */
+    void addPosting(PostingList* postings, int slot);
+
+    /**
+     * @brief Removes a slot from a posting list.
+     *
+     * @param postings The posting list.
+     * @param slot The table slot of the company.
+     * @return void - This function does not return a value.
+     */
+    void removePosting(PostingList* postings, int slot);
+
+    /**
+     * @brief Sorts a posting list if a slot was appended out of order.
+     *
+     * @param postings The posting list.
+     * @return void - This function does not return a value.
+     */
+    void sortPostings(PostingList* postings);
+
+    /**
+     * @brief Intersects posting lists, starting from the shortest one.
+     *
+     * @param lists The posting lists; they are sorted if needed.
+     * @param numLists The number of lists, at least 1.
+     * @param slots Receives a sorted array with the slots present in every list, to be freed by the caller.
+     * @return The number of slots in the intersection, or -1 on failure.
+     */
+    int intersectPostings(PostingList* lists[], int numLists, int** slots);
+
+    /**
+     * @brief Frees the memory of a posting list.
+     *
+     * @param postings The posting list.
+     * @return void - This function does not return a value.
+     */
+    void freePostings(PostingList* postings);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POSTINGS_H */
@@ -0,0 +1,437 @@
+/**
+ * @file query.c
+ * @brief source file for the company queries of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <ctype.h>
+#include "query.h"
+#include "companytable.h"
+#include "symbols.h"
+#include "facet.h"
+#include "trigram.h"
+#include "postalindex.h"
+
+    /*
+     * Reads the next word of the query into token. Double quotes group words with spaces and
+     * are not copied. Returns the position after the word, or NULL at the end of the text.
+     */
+    static const char *nextQueryWord(const char *text, char *token, size_t size) {
+        size_t length = 0;
+        int quoted = 0;
+
+        while (isspace((unsigned char) *text)) {
+            text++;
+        }
+        if (*text == '\0') {
+            return NULL;
+        }
+
+        for (; *text != '\0' && (quoted || !isspace((unsigned char) *text)); text++) {
+            if (*text == '"') {
+                quoted = !quoted;
+            } else if (length + 1 < size) {
+                token[length++] = *text;
+            }
+        }
+        token[length] = '\0';
+        return text;
+    }
+
+    static int parseCondition(const char *word, QueryCondition *condition) {
+        char field[20];
+        const char *value;
+        const char *operator = strpbrk(word, "~=>");
+
+        memset(condition, 0, sizeof(QueryCondition));
+        if (strcmp(word, "active") == 0) {
+            condition->field = QUERY_ACTIVE;
+            return 1;
+        }
+        if (operator == NULL || operator == word || (size_t) (operator - word) >= sizeof(field)) {
+            return 0;
+        }
+
+        memcpy(field, word, operator - word);
+        field[operator - word] = '\0';
+        value = operator + (strncmp(operator, ">=", 2) == 0 ? 2 : 1);
+
+        if (*operator == '~' && (strcmp(field, "name") == 0 || strcmp(field, "locality") == 0)) {
+            condition->field = field[0] == 'n' ? QUERY_NAME_CONTAINS : QUERY_LOCALITY_CONTAINS;
+            foldText(condition->text, sizeof(condition->text), value);
+            return 1;
+        }
+        if (*operator == '>') {
+            condition->field = QUERY_MIN_RATING;
+            return strcmp(field, "rating") == 0 && value[-1] == '=' && sscanf(value, "%f", &condition->rating) == 1;
+        }
+
+        if (strcmp(field, "nif") == 0) {
+            condition->field = QUERY_NIF;
+            return sscanf(value, "%d", &condition->value) == 1;
+        } else if (strcmp(field, "category") == 0) {
+            condition->field = QUERY_CATEGORY;
+            condition->value = parseCategory(value);
+            return condition->value != 0;
+        } else if (strcmp(field, "sector") == 0) {
+            // An unknown sector or locality is valid but matches no company.
+            condition->field = QUERY_SECTOR;
+            condition->value = findSymbol(&sectorSymbols, value);
+            return 1;
+        } else if (strcmp(field, "locality") == 0) {
+            condition->field = QUERY_LOCALITY;
+            condition->value = findSymbol(&localitySymbols, value);
+            return 1;
+        } else if (strcmp(field, "postal") == 0) {
+            condition->field = QUERY_POSTAL_CODE;
+            return parsePostalCodeRange(value, &condition->value, &condition->high);
+        }
+        return 0;
+    }
+
+    int parseQuery(const char *text, Query *query) {
+        char word[200];
+
+        memset(query, 0, sizeof(Query));
+        query->numGroups = 1;
+
+        while ((text = nextQueryWord(text, word, sizeof(word))) != NULL) {
+            QueryGroup *group = &query->groups[query->numGroups - 1];
+
+            if (strcmp(word, "and") == 0) {
+                continue;
+            } else if (strcmp(word, "or") == 0) {
+                if (group->numConditions == 0) {
+                    printf("Error: \"or\" must follow a condition.\n");
+                    return 0;
+                } else if (query->numGroups == MAX_QUERY_GROUPS) {
+                    printf("Error: a query can have at most %d groups of conditions.\n", MAX_QUERY_GROUPS);
+                    return 0;
+                }
+                query->numGroups++;
+            } else if (strcmp(word, "order") == 0) {
+                text = nextQueryWord(text, word, sizeof(word));
+                if (text != NULL && strcmp(word, "name") == 0) {
+                    query->order = ORDER_NAME;
+                } else if (text != NULL && strcmp(word, "rating") == 0) {
+                    query->order = ORDER_RATING;
+                } else if (text != NULL && strcmp(word, "nif") == 0) {
+                    query->order = ORDER_NIF;
+                } else {
+                    printf("Error: \"order\" must be followed by name, rating or nif.\n");
+                    return 0;
+                }
+            } else if (strcmp(word, "limit") == 0) {
+                text = nextQueryWord(text, word, sizeof(word));
+                if (text == NULL || sscanf(word, "%d", &query->limit) != 1 || query->limit <= 0) {
+                    printf("Error: \"limit\" must be followed by a positive number.\n");
+                    return 0;
+                }
+            } else if (group->numConditions == MAX_QUERY_CONDITIONS) {
+                printf("Error: a group can have at most %d conditions.\n", MAX_QUERY_CONDITIONS);
+                return 0;
+            } else if (!parseCondition(word, &group->conditions[group->numConditions++])) {
+                printf("Error: invalid condition \"%s\".\n", word);
+                return 0;
+            }
+
+            if (text == NULL) {
+                break;
+            }
+        }
+
+        if (query->groups[query->numGroups - 1].numConditions == 0) {
+            printf("Error: the query has no conditions.\n");
+            return 0;
+        }
+        return 1;
+    }
+
+    static int isFacetCondition(const QueryCondition *condition) {
+        return condition->field == QUERY_CATEGORY || condition->field == QUERY_SECTOR ||
+                condition->field == QUERY_LOCALITY;
+    }
+
+    static FacetFilter facetFilter(const QueryCondition *condition) {
+        FacetFilter filter = {FACET_CATEGORY, condition->value};
+
+        if (condition->field == QUERY_SECTOR) {
+            filter.field = FACET_SECTOR;
+        } else if (condition->field == QUERY_LOCALITY) {
+            filter.field = FACET_LOCALITY;
+        }
+        return filter;
+    }
+
+    /*
+     * Estimates from the indexes how many companies a condition can match, and through which
+     * index they would be read. Returns -1 if no index can serve the condition.
+     */
+    static int estimateCondition(const CompanyTable *companies, const QueryCondition *condition, QueryAccess *access) {
+        int estimate;
+
+        switch (condition->field) {
+            case QUERY_NIF:
+                *access = ACCESS_NIF_HASH;
+                return findCompanyByNif(companies, condition->value) != NULL;
+            case QUERY_CATEGORY:
+            case QUERY_SECTOR:
+            case QUERY_LOCALITY:
+                *access = ACCESS_FACET;
+                return countFacetMatches(facetFilter(condition));
+            case QUERY_NAME_CONTAINS:
+            case QUERY_LOCALITY_CONTAINS:
+                estimate = estimateCompanyText(condition->field == QUERY_NAME_CONTAINS ? SEARCH_NAME : SEARCH_LOCALITY,
+                        condition->text);
+                *access = estimate >= 0 ? ACCESS_TRIGRAM : ACCESS_TEXT_COLUMN;
+                return estimate >= 0 ? estimate : companies->count;
+            case QUERY_POSTAL_CODE:
+                *access = ACCESS_POSTAL_INDEX;
+                return countCompanyPostalCodes(condition->value, condition->high);
+            case QUERY_ACTIVE:
+                *access = ACCESS_ACTIVE_BITMAP;
+                return bitmapCardinality(&companies->activeSlots);
+            default:
+                return -1;
+        }
+    }
+
+    static void planGroup(const CompanyTable *companies, const QueryGroup *group, QueryGroupPlan *plan) {
+        memset(plan, 0, sizeof(QueryGroupPlan));
+        plan->access = ACCESS_SCAN;
+        plan->condition = -1;
+        plan->estimatedRows = companies->count;
+
+        // Any index beats a scan; among indexes the smallest estimate wins.
+        for (int i = 0; i < group->numConditions; i++) {
+            QueryAccess access;
+            int estimate = estimateCondition(companies, &group->conditions[i], &access);
+
+            if (estimate >= 0 && (plan->access == ACCESS_SCAN || estimate < plan->estimatedRows)) {
+                plan->access = access;
+                plan->condition = i;
+                plan->estimatedRows = estimate;
+            }
+        }
+
+        if (plan->condition >= 0) {
+            plan->served[plan->condition] = 1;
+        }
+        if (plan->access == ACCESS_FACET) {
+            // The posting lists of every facet condition are intersected, restricted to the active
+            // companies if the group asks for them.
+            for (int i = 0; i < group->numConditions; i++) {
+                plan->served[i] = isFacetCondition(&group->conditions[i]) || group->conditions[i].field == QUERY_ACTIVE;
+            }
+        }
+    }
+
+    /*
+     * Reads the companies of a group through the index chosen by the plan.
+     */
+    static int readCandidates(const CompanyTable *companies, const QueryGroup *group, const QueryGroupPlan *plan,
+            Company ***candidates) {
+        const QueryCondition *condition = plan->condition >= 0 ? &group->conditions[plan->condition] : NULL;
+        FacetFilter filters[MAX_QUERY_CONDITIONS];
+        int numFilters = 0;
+        const Bitmap *within = NULL;
+        BitmapIterator active;
+        int slot;
+        int found = 0;
+
+        switch (plan->access) {
+            case ACCESS_FACET:
+                for (int i = 0; i < group->numConditions; i++) {
+                    if (isFacetCondition(&group->conditions[i])) {
+                        filters[numFilters++] = facetFilter(&group->conditions[i]);
+                    } else if (group->conditions[i].field == QUERY_ACTIVE) {
+                        within = &companies->activeSlots;
+                    }
+                }
+                return searchCompanyFacets(companies, filters, numFilters, within, candidates);
+            case ACCESS_TRIGRAM:
+            case ACCESS_TEXT_COLUMN:
+                return searchCompanyText(companies, condition->field == QUERY_NAME_CONTAINS ? SEARCH_NAME : SEARCH_LOCALITY,
+                        condition->text, candidates);
+            case ACCESS_POSTAL_INDEX:
+                return searchCompanyPostalCodes(companies, condition->value, condition->high, candidates);
+            default:
+                break;
+        }
+
+        *candidates = malloc((companies->count + 1) * sizeof(Company *));
+        if (*candidates == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        if (plan->access == ACCESS_NIF_HASH) {
+            Company *company = findCompanyByNif(companies, condition->value);
+            if (company != NULL) {
+                (*candidates)[found++] = company;
+            }
+        } else if (plan->access == ACCESS_ACTIVE_BITMAP) {
+            bitmapIterate(&companies->activeSlots, &active);
+            while (bitmapNext(&active, &slot)) {
+                Company *company = companyBySlot(companies, slot);
+                if (company != NULL) {
+                    (*candidates)[found++] = company;
+                }
+            }
+        } else {
+            for (int i = 0; i < companies->count; i++) {
+                (*candidates)[found++] = companyAt(companies, i);
+            }
+        }
+        return found;
+    }
+
+    static int matchesCondition(const Company *company, const QueryCondition *condition) {
+        switch (condition->field) {
+            case QUERY_NAME_CONTAINS:
+                return strstr(company->nameKey, condition->text) != NULL;
+            case QUERY_LOCALITY_CONTAINS:
+                return strstr(company->localityKey, condition->text) != NULL;
+            case QUERY_NIF:
+                return company->nif == condition->value;
+            case QUERY_CATEGORY:
+                return (int) company->category == condition->value;
+            case QUERY_SECTOR:
+                return company->sectorId == condition->value;
+            case QUERY_LOCALITY:
+                return company->localityId == condition->value;
+            case QUERY_POSTAL_CODE:
+                return company->postalCodeValue >= condition->value && company->postalCodeValue <= condition->high;
+            case QUERY_MIN_RATING:
+                return calculateAverageRating(&company->ratings) >= condition->rating;
+            case QUERY_ACTIVE:
+                return company->active;
+            default:
+                return 0;
+        }
+    }
+
+    int runQuery(const CompanyTable *companies, const Query *query, Company ***results, QueryPlan *plan) {
+        Bitmap seen = {0};
+        int found = 0;
+
+        memset(plan, 0, sizeof(QueryPlan));
+        *results = malloc((companies->count + 1) * sizeof(Company *));
+        if (*results == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        for (int g = 0; g < query->numGroups; g++) {
+            const QueryGroup *group = &query->groups[g];
+            QueryGroupPlan *groupPlan = &plan->groups[g];
+            Company **candidates;
+
+            planGroup(companies, group, groupPlan);
+            int numCandidates = readCandidates(companies, group, groupPlan, &candidates);
+            if (numCandidates < 0) {
+                freeBitmap(&seen);
+                free(*results);
+                *results = NULL;
+                return -1;
+            }
+            groupPlan->examinedRows = numCandidates;
+
+            for (int i = 0; i < numCandidates; i++) {
+                Company *company = candidates[i];
+                int matches = 1;
+
+                for (int c = 0; c < group->numConditions && matches; c++) {
+                    matches = groupPlan->served[c] || matchesCondition(company, &group->conditions[c]);
+                }
+                if (!matches) {
+                    continue;
+                }
+                groupPlan->matchedRows++;
+
+                // A company matching several groups is only returned once.
+                if (query->numGroups > 1) {
+                    if (bitmapContains(&seen, company->tableSlot)) {
+                        continue;
+                    }
+                    bitmapAdd(&seen, company->tableSlot);
+                }
+                (*results)[found++] = company;
+            }
+            free(candidates);
+        }
+        freeBitmap(&seen);
+
+        // Only the companies within the limit are picked out; they are sorted page by page when shown.
+        plan->numMatches = found;
+        if (query->limit > 0 && found > query->limit) {
+            selectFirstResults(*results, found, query->order, query->limit);
+            found = query->limit;
+        }
+        return found;
+    }
+
+    static void describeCondition(const QueryCondition *condition, char *buffer, size_t size) {
+        switch (condition->field) {
+            case QUERY_NAME_CONTAINS:
+                snprintf(buffer, size, "name contains \"%s\"", condition->text);
+                break;
+            case QUERY_LOCALITY_CONTAINS:
+                snprintf(buffer, size, "locality contains \"%s\"", condition->text);
+                break;
+            case QUERY_NIF:
+                snprintf(buffer, size, "nif = %d", condition->value);
+                break;
+            case QUERY_CATEGORY:
+                snprintf(buffer, size, "category = %s", getCategoryName(condition->value));
+                break;
+            case QUERY_SECTOR:
+                snprintf(buffer, size, "sector = %s", condition->value >= 0 ?
+                        symbolName(&sectorSymbols, condition->value) : "(unknown)");
+                break;
+            case QUERY_LOCALITY:
+                snprintf(buffer, size, "locality = %s", condition->value >= 0 ?
+                        symbolName(&localitySymbols, condition->value) : "(unknown)");
+                break;
+            case QUERY_POSTAL_CODE:
+                snprintf(buffer, size, "postal code from %04d-%03d to %04d-%03d", condition->value / 1000,
+                        condition->value % 1000, condition->high / 1000, condition->high % 1000);
+                break;
+            case QUERY_MIN_RATING:
+                snprintf(buffer, size, "rating >= %.2f", condition->rating);
+                break;
+            default:
+                snprintf(buffer, size, "active");
+                break;
+        }
+    }
+
+    void printQueryPlan(const Query *query, const QueryPlan *plan) {
+        static const char *accessNames[] = {"full scan", "NIF hash", "facet postings", "trigram index",
+            "text column scan", "postal code index", "active bitmap"};
+        char description[160];
+
+        printf("Plan:\n");
+        for (int g = 0; g < query->numGroups; g++) {
+            const QueryGroup *group = &query->groups[g];
+            const QueryGroupPlan *groupPlan = &plan->groups[g];
+
+            printf("  Group %d: %s (estimated %d, read %d, matched %d)\n", g + 1, accessNames[groupPlan->access],
+                    groupPlan->estimatedRows, groupPlan->examinedRows, groupPlan->matchedRows);
+            for (int c = 0; c < group->numConditions; c++) {
+                describeCondition(&group->conditions[c], description, sizeof(description));
+                printf("    %s %s\n", groupPlan->served[c] ? "index: " : "filter:", description);
+            }
+        }
+        if (query->numGroups > 1) {
+            printf("  Union of %d groups: %d companies\n", query->numGroups, plan->numMatches);
+        }
+        printf("  Order by %s", getResultOrderName(query->order));
+        if (query->limit > 0) {
+            printf(", limit %d", query->limit);
+        }
+        printf("\n");
+    }
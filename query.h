@@ -0,0 +1,157 @@
+/**
+ * @file query.h
+ * @brief Header file for the company queries of the Company Management System.
+ *
+ * A query is a list of groups joined by OR, each group a list of conditions joined by AND, with
+ * an optional ordering and limit. It is written as text, for example:
+ *
+ *   sector=Vendas and rating>=4 or name~"padaria central" and active order rating limit 10
+ *
+ * For each group the planner estimates, from the indexes, how many companies every condition can
+ * match: the NIF hash, the facet posting lists, the trigram indexes, the postal code index and
+ * the bitmap of active companies. The companies of the condition with the smallest estimate are
+ * read from its index and the other conditions are checked on each of them. The companies are
+ * only scanned when no condition of the group can use an index. The plan chosen is recorded so
+ * it can be printed.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include "utilities.h"
+#include "resultcursor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Largest number of conditions in one group.
+     */
+    #define MAX_QUERY_CONDITIONS 8
+
+    /**
+     * @brief Largest number of groups in one query.
+     */
+    #define MAX_QUERY_GROUPS 4
+
+    /**
+     * @brief Enumeration representing the fields a condition can test.
+     */
+    typedef enum {
+        QUERY_NAME_CONTAINS,      // name~text
+        QUERY_LOCALITY_CONTAINS,  // locality~text
+        QUERY_NIF,                // nif=123456789
+        QUERY_CATEGORY,           // category=SMALL
+        QUERY_SECTOR,             // sector=Vendas
+        QUERY_LOCALITY,           // locality=Porto
+        QUERY_POSTAL_CODE,        // postal=4700 or postal=4700:4799
+        QUERY_MIN_RATING,         // rating>=4
+        QUERY_ACTIVE              // active
+    } QueryField;
+
+    /**
+     * @brief Structure representing one condition of a query.
+     */
+    typedef struct {
+        QueryField field;
+        char text[100];  // the folded text of the contains conditions
+        int value;       // the NIF, category, sector or locality id, or the smallest packed postal code
+        int high;        // the largest packed postal code
+        float rating;    // the smallest average rating
+    } QueryCondition;
+
+    /**
+     * @brief Structure representing conditions joined by AND.
+     */
+    typedef struct {
+        QueryCondition conditions[MAX_QUERY_CONDITIONS];
+        int numConditions;
+    } QueryGroup;
+
+    /**
+     * @brief Structure representing a query: groups joined by OR.
+     */
+    typedef struct {
+        QueryGroup groups[MAX_QUERY_GROUPS];
+        int numGroups;
+        ResultOrder order;
+        int limit;  // 0 for no limit
+    } Query;
+
+    /**
+     * @brief Enumeration representing the ways the companies of a group are read.
+     */
+    typedef enum {
+        ACCESS_SCAN,           // every company of the table
+        ACCESS_NIF_HASH,       // the NIF hash of the company table
+        ACCESS_FACET,          // the intersection of the facet posting lists
+        ACCESS_TRIGRAM,        // the trigram index
+        ACCESS_TEXT_COLUMN,    // the packed text column, for terms too short for the trigram index
+        ACCESS_POSTAL_INDEX,   // the postal code index
+        ACCESS_ACTIVE_BITMAP   // the bitmap of active companies
+    } QueryAccess;
+
+    /**
+     * @brief Structure representing how one group was run.
+     */
+    typedef struct {
+        QueryAccess access;
+        int condition;      // the condition read from the index, -1 for a scan
+        int served[MAX_QUERY_CONDITIONS];  // 1 for the conditions answered by the index itself
+        int estimatedRows;  // the estimate that chose the index
+        int examinedRows;   // the companies read from the index
+        int matchedRows;    // the companies matching every condition
+    } QueryGroupPlan;
+
+    /**
+     * @brief Structure representing how a query was run.
+     */
+    typedef struct {
+        QueryGroupPlan groups[MAX_QUERY_GROUPS];
+        int numMatches;  // the companies matching the query, before the limit
+    } QueryPlan;
+
+    /**
+     * @brief Reads a query from its text.
+     *
+     * Conditions are separated by spaces or "and", groups by "or". Values with spaces are
+     * written between double quotes. Errors are printed.
+     *
+     * @param text The text of the query.
+     * @param query Receives the query.
+     * @return 1 on success, 0 if the text is not a valid query.
+     */
+    int parseQuery(const char* text, Query* query);
+
+    /**
+     * @brief Runs a query.
+     *
+     * The results are not sorted, but are meant to be shown in the order of the query through a
+     * cursor (see openResultCursor). With a limit, they are the first companies in that order.
+     *
+     * @param companies The company table.
+     * @param query The query.
+     * @param results Receives an array with the matching companies, to be freed by the caller.
+     * @param plan Receives how the query was run.
+     * @return The number of companies in the results, or -1 on failure.
+     */
+    int runQuery(const CompanyTable* companies, const Query* query, Company*** results, QueryPlan* plan);
+
+    /**
+     * @brief Prints how a query was run.
+     *
+     * @param query The query.
+     * @param plan The plan filled by runQuery.
+     * @return void - This function does not return a value.
+     */
+    void printQueryPlan(const Query* query, const QueryPlan* plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUERY_H */
@@ -1,104 +1,132 @@
-/**
- * @file report.c
- * @brief source file for generating and viewing reports on company evaluations and information.
- *
- * @author Vitor and Diogo (Group 16)
- * @date 11-01-2024
- *
-
- */
-
-#include "utilities.h"
-#include "adm.h"
-#include "user.h"
-#include "report.h"
-
-    void viewReports() {
-        int numCompanies = loadCompanyCount();
-        loadCompaniesFromFile(companies, &numCompanies);
-        loadCommentsFromFile(companies, &numCompanies);
-        loadRatingsFromFile(companies, numCompanies);
-
-        printf("\nList of Companies:\n");
-
-        for (int i = 0; i < numCompanies; i++) {
-            printf("%d. %s\n", i + 1, companies[i].name);
-        }
-
-        int choice;
-        printf("Select a company to view report: ");
-        scanf("%d", &choice);
-
-        getchar();
-
-        if (choice >= 1 && choice <= numCompanies) {
-            int selectedCompanyId = choice - 1;
-            Company selectedCompany = companies[selectedCompanyId];
-
-            char fileName[100];
-            sprintf(fileName, "%s_report.txt", selectedCompany.name);
-
-            printf("\nCompany Details:\n");
-            printf("Name: %s\n", selectedCompany.name);
-            printf("NIF: %d\n", selectedCompany.nif);
-            printf("Category: %s\n", selectedCompany.category);
-            printf("Business Sector: %s\n", selectedCompany.businessSector);
-            printf("Street: %s\n", selectedCompany.street);
-            printf("Locality: %s\n", selectedCompany.locality);
-            printf("Postal Code: %s\n", selectedCompany.postalCode);
-            printf("Status: %s\n", selectedCompany.active ? "Active" : "Inactive");
-            printf("Average Rating: %.2f\n", selectedCompany.averageRating);
-
-            printf("\nLast Comment:\n");
-            for (int i = 0; i < selectedCompany.numComments; i++) {
-                printf("Username: %s\n", selectedCompany.comments[i].username);
-                printf("Title: %s\n", selectedCompany.comments[i].title);
-                printf("Text: %s\n", selectedCompany.comments[i].text);
-                printf("\n");
-            }
-
-            printf("\nRatings:\n");
-            for (int i = 0; i < selectedCompany.numRatings; i++) {
-                printf("%.2f ", selectedCompany.ratings[i]);
-            }
-            printf("\n");
-
-            FILE *file = fopen(fileName, "w");
-            if (file == NULL) {
-                printf("Error opening the file for writing.\n");
-                return;
-            }
-
-            fprintf(file, "\nCompany Details:\n");
-            fprintf(file, "Name: %s\n", selectedCompany.name);
-            fprintf(file, "NIF: %d\n", selectedCompany.nif);
-            fprintf(file, "Category: %s\n", selectedCompany.category);
-            fprintf(file, "Business Sector: %s\n", selectedCompany.businessSector);
-            fprintf(file, "Street: %s\n", selectedCompany.street);
-            fprintf(file, "Locality: %s\n", selectedCompany.locality);
-            fprintf(file, "Postal Code: %s\n", selectedCompany.postalCode);
-            fprintf(file, "Status: %s\n", selectedCompany.active ? "Active" : "Inactive");
-            fprintf(file, "Average Rating: %.2f\n", selectedCompany.averageRating);
-
-            fprintf(file, "\nLast Comment:\n");
-            for (int i = 0; i < selectedCompany.numComments; i++) {
-                fprintf(file, "Username: %s\n", selectedCompany.comments[i].username);
-                fprintf(file, "Title: %s\n", selectedCompany.comments[i].title);
-                fprintf(file, "Text: %s\n", selectedCompany.comments[i].text);
-                fprintf(file, "\n");
-            }
-
-            fprintf(file, "\nRatings:\n");
-            for (int i = 0; i < selectedCompany.numRatings; i++) {
-                fprintf(file, "%.2f ", selectedCompany.ratings[i]);
-            }
-            fprintf(file, "\n");
-
-            fclose(file);
-
-            printf("Relatório salvo em %s\n", fileName);
-        } else {
-            printf("Escolha inválida. Por favor, tente novamente.\n");
-        }
-    }
-
+/**
+ * @file report.c
+ * @brief source file for generating and viewing reports on company evaluations and information.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 11-01-2024
+ *
+
+ */
+
+#include "utilities.h"
+#include "adm.h"
+#include "user.h"
+#include "report.h"
+#include "commentlog.h"
+#include "journal.h"
+#include "symbols.h"
+#include "companytable.h"
+
+    static void printRatingSummary(FILE *out, const RatingAggregate *ratings) {
+        fprintf(out, "Average Rating: %.2f\n", calculateAverageRating(ratings));
+        fprintf(out, "Number of Ratings: %d\n", ratings->count);
+        fprintf(out, "Rating Variance: %.2f\n", calculateRatingVariance(ratings));
+        fprintf(out, "Rating Distribution:");
+        for (int i = 0; i <= MAX_RATING - MIN_RATING; i++) {
+            fprintf(out, " %d: %d", MIN_RATING + i, ratings->histogram[i]);
+        }
+        fprintf(out, "\n");
+    }
+
+    void viewReports() {
+        printf("\nList of Companies:\n");
+
+        for (int i = 0; i < companies.count; i++) {
+            printf("%d. %s\n", i + 1, companyAt(&companies, i)->name);
+        }
+
+        int choice;
+        printf("Select a company to view report: ");
+        scanf("%d", &choice);
+
+        getchar();
+
+        if (choice >= 1 && choice <= companies.count) {
+            int selectedCompanyId = choice - 1;
+            Company selectedCompany = *companyAt(&companies, selectedCompanyId);
+
+            // The comments and the ratings are only read from their files for the report.
+            Comment *comments = malloc((selectedCompany.numComments + 1) * sizeof(Comment));
+            float *ratings = malloc((selectedCompany.ratings.count + 1) * sizeof(float));
+
+            if (comments == NULL || ratings == NULL) {
+                printf("Memory allocation error.\n");
+                free(comments);
+                free(ratings);
+                return;
+            }
+
+            int loadedComments = loadCompanyComments(selectedCompany.nif, comments, selectedCompany.numComments);
+            int loadedRatings = loadCompanyRatings(selectedCompany.nif, ratings, selectedCompany.ratings.count);
+
+            char fileName[100];
+            sprintf(fileName, "%s_report.txt", selectedCompany.name);
+
+            printf("\nCompany Details:\n");
+            printf("Name: %s\n", selectedCompany.name);
+            printf("NIF: %d\n", selectedCompany.nif);
+            printf("Category: %s\n", getCategoryName(selectedCompany.category));
+            printf("Business Sector: %s\n", symbolName(&sectorSymbols, selectedCompany.sectorId));
+            printf("Street: %s\n", selectedCompany.street);
+            printf("Locality: %s\n", symbolName(&localitySymbols, selectedCompany.localityId));
+            printf("Postal Code: %s\n", selectedCompany.postalCode);
+            printf("Status: %s\n", selectedCompany.active ? "Active" : "Inactive");
+            printRatingSummary(stdout, &selectedCompany.ratings);
+
+            printf("\nLast Comment:\n");
+            for (int i = 0; i < loadedComments; i++) {
+                printf("Username: %s\n", comments[i].username);
+                printf("Title: %s\n", comments[i].title);
+                printf("Text: %s\n", comments[i].text);
+                printf("\n");
+            }
+
+            printf("\nRatings:\n");
+            for (int i = 0; i < loadedRatings; i++) {
+                printf("%.2f ", ratings[i]);
+            }
+            printf("\n");
+
+            FILE *file = fopen(fileName, "w");
+            if (file == NULL) {
+                printf("Error opening the file for writing.\n");
+                free(comments);
+                free(ratings);
+                return;
+            }
+
+            fprintf(file, "\nCompany Details:\n");
+            fprintf(file, "Name: %s\n", selectedCompany.name);
+            fprintf(file, "NIF: %d\n", selectedCompany.nif);
+            fprintf(file, "Category: %s\n", getCategoryName(selectedCompany.category));
+            fprintf(file, "Business Sector: %s\n", symbolName(&sectorSymbols, selectedCompany.sectorId));
+            fprintf(file, "Street: %s\n", selectedCompany.street);
+            fprintf(file, "Locality: %s\n", symbolName(&localitySymbols, selectedCompany.localityId));
+            fprintf(file, "Postal Code: %s\n", selectedCompany.postalCode);
+            fprintf(file, "Status: %s\n", selectedCompany.active ? "Active" : "Inactive");
+            printRatingSummary(file, &selectedCompany.ratings);
+
+            fprintf(file, "\nLast Comment:\n");
+            for (int i = 0; i < loadedComments; i++) {
+                fprintf(file, "Username: %s\n", comments[i].username);
+                fprintf(file, "Title: %s\n", comments[i].title);
+                fprintf(file, "Text: %s\n", comments[i].text);
+                fprintf(file, "\n");
+            }
+
+            fprintf(file, "\nRatings:\n");
+            for (int i = 0; i < loadedRatings; i++) {
+                fprintf(file, "%.2f ", ratings[i]);
+            }
+            fprintf(file, "\n");
+
+            fclose(file);
+            free(comments);
+            free(ratings);
+
+            printf("Relatório salvo em %s\n", fileName);
+        } else {
+            printf("Escolha inválida. Por favor, tente novamente.\n");
+        }
+    }
+
@@ -1,33 +1,33 @@
-/**
- * @file reports.h
- * @brief Header file for generating and viewing reports on company evaluations and information.
- *
- * @author Vitor and Diogo (Group 16)
- * @date 11st January 2024
- */
-
-#ifndef REPORT_H
-#define REPORT_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/**
- * @brief Displays various reports on company evaluations and information.
- *
- * This function generates and displays reports containing information such as the average rating,
- * the total number of ratings, the number of comments, and additional details about each company.
- * The reports aim to provide the administrator with insights into user interactions and company performance.
- *
- * @return void - This function does not return a value.
- */
-void viewReports();
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* REPORT_H */
-
+/**
+ * @file reports.h
+ * @brief Header file for generating and viewing reports on company evaluations and information.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 11st January 2024
+ */
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Displays various reports on company evaluations and information.
+ *
+ * This function generates and displays reports containing information such as the average rating,
+ * the total number of ratings, the number of comments, and additional details about each company.
+ * The reports aim to provide the administrator with insights into user interactions and company performance.
+ *
+ * @return void - This function does not return a value.
+ */
+void viewReports();
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REPORT_H */
+
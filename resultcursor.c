@@ -0,0 +1,208 @@
+/**
+ * @file resultcursor.c
+ * @brief source file for the ordered result pages of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "resultcursor.h"
+
+/**
+ * @brief Structure representing a cursor over the pages of an array of companies.
+ */
+struct ResultCursor {
+    Company **results;
+    int numResults;
+    ResultOrder order;
+    int pageSize;
+    int numOrdered;   // the companies at the front already in their final order
+    int numSelected;  // the companies at the front that come before all the others, numOrdered or more
+};
+
+    static int compareByNif(const void *a, const void *b) {
+        const Company *x = *(Company * const *) a;
+        const Company *y = *(Company * const *) b;
+        return (x->nif > y->nif) - (x->nif < y->nif);
+    }
+
+    static int compareByName(const void *a, const void *b) {
+        int order = strcmp((*(Company * const *) a)->nameKey, (*(Company * const *) b)->nameKey);
+        return order != 0 ? order : compareByNif(a, b);
+    }
+
+    static int compareByRating(const void *a, const void *b) {
+        const Company *x = *(Company * const *) a;
+        const Company *y = *(Company * const *) b;
+        float averageX = calculateAverageRating(&x->ratings);
+        float averageY = calculateAverageRating(&y->ratings);
+
+        if (averageX != averageY) {
+            return averageX > averageY ? -1 : 1;
+        }
+        if (x->ratings.count != y->ratings.count) {
+            return x->ratings.count > y->ratings.count ? -1 : 1;
+        }
+        return compareByNif(a, b);
+    }
+
+    static int (*getComparator(ResultOrder order))(const void *, const void *) {
+        switch (order) {
+            case ORDER_NAME:
+                return compareByName;
+            case ORDER_RATING:
+                return compareByRating;
+            case ORDER_NIF:
+                return compareByNif;
+            default:
+                return NULL;
+        }
+    }
+
+    static void swapResults(Company **results, int a, int b) {
+        Company *company = results[a];
+        results[a] = results[b];
+        results[b] = company;
+    }
+
+    const char *getResultOrderName(ResultOrder order) {
+        static const char *names[] = {"order found", "name", "rating", "NIF"};
+        return names[order];
+    }
+
+    void selectFirstResults(Company **results, int numResults, ResultOrder order, int count) {
+        int (*compare)(const void *, const void *) = getComparator(order);
+        int low = 0;
+        int high = numResults - 1;
+
+        if (compare == NULL || count <= 0 || count >= numResults) {
+            return;
+        }
+
+        // Quickselect for the company at position count: afterwards every company before it
+        // comes first in the order.
+        while (low < high) {
+            int middle = low + (high - low) / 2;
+
+            // The median of three is the pivot, kept at high during the partition.
+            if (compare(&results[middle], &results[low]) < 0) {
+                swapResults(results, middle, low);
+            }
+            if (compare(&results[high], &results[low]) < 0) {
+                swapResults(results, high, low);
+            }
+            if (compare(&results[middle], &results[high]) < 0) {
+                swapResults(results, middle, high);
+            }
+
+            int store = low;
+            for (int i = low; i < high; i++) {
+                if (compare(&results[i], &results[high]) < 0) {
+                    swapResults(results, i, store++);
+                }
+            }
+            swapResults(results, store, high);
+
+            if (store == count) {
+                return;
+            } else if (store < count) {
+                low = store + 1;
+            } else {
+                high = store - 1;
+            }
+        }
+    }
+
+    ResultCursor *openResultCursor(Company **results, int numResults, ResultOrder order, int pageSize) {
+        ResultCursor *cursor = malloc(sizeof(ResultCursor));
+
+        if (cursor == NULL) {
+            printf("Memory allocation error.\n");
+            return NULL;
+        }
+
+        cursor->results = results;
+        cursor->numResults = numResults > 0 ? numResults : 0;
+        cursor->pageSize = pageSize > 0 ? pageSize : RESULT_PAGE_SIZE;
+        reorderResultCursor(cursor, order);
+        return cursor;
+    }
+
+    void reorderResultCursor(ResultCursor *cursor, ResultOrder order) {
+        cursor->order = order;
+        cursor->numOrdered = order == ORDER_NONE ? cursor->numResults : 0;
+        cursor->numSelected = cursor->numOrdered;
+    }
+
+    int countResultPages(const ResultCursor *cursor) {
+        return (cursor->numResults + cursor->pageSize - 1) / cursor->pageSize;
+    }
+
+    int fetchResultPage(ResultCursor *cursor, int page, Company ***rows) {
+        int first = page * cursor->pageSize;
+        int end = first + cursor->pageSize < cursor->numResults ? first + cursor->pageSize : cursor->numResults;
+
+        if (page < 0 || first >= cursor->numResults) {
+            return 0;
+        }
+
+        if (end > cursor->numSelected) {
+            // Twice as many companies as needed are selected from the whole array, so the next
+            // pages are selected among them without going through the array again.
+            int selected = 2 * end < cursor->numResults ? 2 * end : cursor->numResults;
+
+            selectFirstResults(&cursor->results[cursor->numSelected], cursor->numResults - cursor->numSelected,
+                    cursor->order, selected - cursor->numSelected);
+            cursor->numSelected = selected;
+        }
+
+        if (end > cursor->numOrdered) {
+            // Only the companies up to the end of the page are taken from those not yet ordered.
+            Company **unordered = &cursor->results[cursor->numOrdered];
+
+            selectFirstResults(unordered, cursor->numSelected - cursor->numOrdered, cursor->order, end - cursor->numOrdered);
+            qsort(unordered, end - cursor->numOrdered, sizeof(Company *), getComparator(cursor->order));
+            cursor->numOrdered = end;
+        }
+
+        *rows = &cursor->results[first];
+        return end - first;
+    }
+
+    void browseResults(ResultCursor *cursor, void (*printResult)(const Company *company, int number)) {
+        int numPages = countResultPages(cursor);
+        int page = 0;
+        char option;
+
+        while (page < numPages) {
+            Company **rows;
+            int numRows = fetchResultPage(cursor, page, &rows);
+
+            for (int i = 0; i < numRows; i++) {
+                printResult(rows[i], page * cursor->pageSize + i + 1);
+            }
+            if (numPages == 1) {
+                return;
+            }
+
+            printf("Page %d of %d, by %s. Next (n), previous (p), order by name (1), rating (2) or NIF (3), stop (q): ",
+                    page + 1, numPages, getResultOrderName(cursor->order));
+            scanf(" %c", &option);
+
+            if (option == 'n' || option == 'N') {
+                page++;
+            } else if (option == 'p' || option == 'P') {
+                page = page > 0 ? page - 1 : 0;
+            } else if (option >= '1' && option <= '3') {
+                reorderResultCursor(cursor, (ResultOrder) (option - '0'));
+                page = 0;
+            } else {
+                return;
+            }
+        }
+    }
+
+    void closeResultCursor(ResultCursor *cursor) {
+        free(cursor);
+    }
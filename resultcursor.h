@@ -0,0 +1,128 @@
+/**
+ * @file resultcursor.h
+ * @brief Header file for the ordered result pages of the Company Management System.
+ *
+ * A cursor shows an array of companies one page at a time, by name, rating or NIF. The whole
+ * array is never sorted: when a page is fetched, a selection (quickselect, as nth_element)
+ * moves the companies of the pages up to it in front of the others in O(n), and only the page
+ * is sorted. The cursor remembers how many companies at the front are already in their final
+ * order, so going back costs nothing. Twice as many companies as needed are selected, so the
+ * next pages are selected among them and the whole array is only gone through again after the
+ * number of pages shown has doubled.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef RESULTCURSOR_H
+#define RESULTCURSOR_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Number of companies shown in each page.
+     */
+    #define RESULT_PAGE_SIZE 10
+
+    /**
+     * @brief Enumeration representing the orderings of the results.
+     */
+    typedef enum {
+        ORDER_NONE,    // the order the results were found in
+        ORDER_NAME,
+        ORDER_RATING,  // best rated first
+        ORDER_NIF
+    } ResultOrder;
+
+    /**
+     * @brief A cursor over the pages of an array of companies. Its fields are private.
+     */
+    typedef struct ResultCursor ResultCursor;
+
+    /**
+     * @brief Gets the name of an ordering.
+     *
+     * @param order The ordering.
+     * @return The name of the ordering.
+     */
+    const char* getResultOrderName(ResultOrder order);
+
+    /**
+     * @brief Moves the first companies in an ordering to the front of an array, in O(n) on average.
+     *
+     * The companies moved are not ordered among themselves.
+     *
+     * @param results The companies.
+     * @param numResults The number of companies.
+     * @param order The ordering.
+     * @param count The number of companies to move to the front.
+     * @return void - This function does not return a value.
+     */
+    void selectFirstResults(Company** results, int numResults, ResultOrder order, int count);
+
+    /**
+     * @brief Opens a cursor over an array of companies.
+     *
+     * The array is reordered in place as pages are fetched, and must outlive the cursor.
+     *
+     * @param results The companies.
+     * @param numResults The number of companies.
+     * @param order The ordering.
+     * @param pageSize The number of companies in each page.
+     * @return The cursor, or NULL if memory could not be allocated.
+     */
+    ResultCursor* openResultCursor(Company** results, int numResults, ResultOrder order, int pageSize);
+
+    /**
+     * @brief Changes the ordering of a cursor.
+     *
+     * @param cursor The cursor.
+     * @param order The new ordering.
+     * @return void - This function does not return a value.
+     */
+    void reorderResultCursor(ResultCursor* cursor, ResultOrder order);
+
+    /**
+     * @brief Gets the number of pages of a cursor.
+     *
+     * @param cursor The cursor.
+     * @return The number of pages.
+     */
+    int countResultPages(const ResultCursor* cursor);
+
+    /**
+     * @brief Fetches a page of a cursor.
+     *
+     * @param cursor The cursor.
+     * @param page The number of the page, from 0.
+     * @param rows Receives the companies of the page, in order, inside the array of the cursor.
+     * @return The number of companies in the page, 0 past the last page.
+     */
+    int fetchResultPage(ResultCursor* cursor, int page, Company*** rows);
+
+    /**
+     * @brief Shows the pages of a cursor, asking the user to move between pages or change the ordering.
+     *
+     * @param cursor The cursor.
+     * @param printResult Prints one company, given its number in the ordering, from 1.
+     * @return void - This function does not return a value.
+     */
+    void browseResults(ResultCursor* cursor, void (*printResult)(const Company* company, int number));
+
+    /**
+     * @brief Frees the memory of a cursor, but not of its array.
+     *
+     * @param cursor The cursor.
+     * @return void - This function does not return a value.
+     */
+    void closeResultCursor(ResultCursor* cursor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESULTCURSOR_H */
@@ -0,0 +1,171 @@
+/**
+ * @file snapshot.c
+ * @brief source file for the catalog snapshot of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <sys/stat.h>
+#include <unistd.h>
+#include "snapshot.h"
+#include "store.h"
+#include "journal.h"
+#include "commentlog.h"
+#include "companytable.h"
+#include "symbols.h"
+
+    static uint64_t fileSize(const char *path) {
+        struct stat st;
+        return stat(path, &st) == 0 ? (uint64_t) st.st_size : 0;
+    }
+
+    static int isCurrentSnapshot(const SnapshotHeader *header, size_t size) {
+        if (header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION ||
+                header->companySize != sizeof(SnapshotCompany) ||
+                size != sizeof(SnapshotHeader) + (size_t) header->numCompanies * sizeof(SnapshotCompany)) {
+            return 0;
+        }
+
+        return header->storeGeneration == getStoreGeneration() &&
+                header->journalSize == fileSize(JOURNAL_FILE) &&
+                header->commentLogSize == fileSize(COMMENT_LOG_FILE);
+    }
+
+    static int loadSnapshot(CompanyTable *companies) {
+        FILE *file = fopen(SNAPSHOT_FILE, "rb");
+
+        if (file == NULL) {
+            return 0;
+        }
+
+        // The header is checked before the companies are read, so an out of date snapshot
+        // costs one small read and not a read of the whole file.
+        SnapshotHeader header;
+        size_t size = fileSize(SNAPSHOT_FILE);
+
+        if (fread(&header, sizeof(header), 1, file) != 1 || !isCurrentSnapshot(&header, size)) {
+            fclose(file);
+            return 0;
+        }
+
+        SnapshotCompany *records = malloc((header.numCompanies + 1) * sizeof(SnapshotCompany));
+        int ok = records != NULL &&
+                fread(records, sizeof(SnapshotCompany), header.numCompanies, file) == header.numCompanies;
+        fclose(file);
+
+        if (!ok) {
+            free(records);
+            return 0;
+        }
+
+        clearCompanyTable(companies);
+        for (uint32_t i = 0; i < header.numCompanies && ok; i++) {
+            const SnapshotCompany *record = &records[i];
+            Company *company = addCompany(companies);
+
+            ok = company != NULL && record->numRatings >= 0 && record->numComments >= 0;
+            if (!ok) {
+                break;
+            }
+
+            company->nif = record->nif;
+            setCompanyActive(companies, company, record->active);
+            company->storeSlot = record->storeSlot;
+            company->dirty = 0;
+            setCompanyName(company, record->name);
+            company->category = parseCategory(record->category);
+            setCompanySector(companies, company, internSymbol(&sectorSymbols, record->businessSector));
+            memcpy(company->street, record->street, sizeof(company->street));
+            setCompanyLocality(company, record->locality);
+            setCompanyPostalCode(company, record->postalCode);
+            memcpy(company->activity, record->activity, sizeof(company->activity));
+
+            company->ratings.count = record->numRatings;
+            company->ratings.sum = record->ratingSum;
+            company->ratings.sumOfSquares = record->ratingSumOfSquares;
+            memcpy(company->ratings.histogram, record->ratingHistogram, sizeof(company->ratings.histogram));
+            company->numComments = record->numComments;
+            indexCompanyNif(companies, company);
+        }
+
+        if (!ok) {
+            clearCompanyTable(companies);
+        }
+        free(records);
+        return ok;
+    }
+
+    int loadCatalog(CompanyTable *companies) {
+        int fromSnapshot = loadSnapshot(companies);
+
+        if (!fromSnapshot) {
+            loadCompaniesFromFile(companies);
+            loadCommentsFromFile(companies);
+            loadRatingsFromFile(companies);
+        }
+
+        return fromSnapshot;
+    }
+
+    int saveSnapshot(const CompanyTable *companies) {
+        SnapshotHeader header;
+
+        memset(&header, 0, sizeof(header));
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.companySize = sizeof(SnapshotCompany);
+        header.numCompanies = companies->count;
+        header.storeGeneration = getStoreGeneration();
+        header.journalSize = fileSize(JOURNAL_FILE);
+        header.commentLogSize = fileSize(COMMENT_LOG_FILE);
+
+        size_t size = sizeof(SnapshotHeader) + companies->count * sizeof(SnapshotCompany);
+        char *buffer = calloc(1, size);
+
+        if (buffer == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        memcpy(buffer, &header, sizeof(header));
+        SnapshotCompany *records = (SnapshotCompany *) (buffer + sizeof(header));
+
+        for (int i = 0; i < companies->count; i++) {
+            const Company *company = companyAt(companies, i);
+            SnapshotCompany *record = &records[i];
+
+            record->nif = company->nif;
+            record->active = company->active;
+            record->storeSlot = company->storeSlot;
+            record->numComments = company->numComments;
+            record->numRatings = company->ratings.count;
+            record->ratingSum = company->ratings.sum;
+            record->ratingSumOfSquares = company->ratings.sumOfSquares;
+            memcpy(record->ratingHistogram, company->ratings.histogram, sizeof(record->ratingHistogram));
+            memcpy(record->name, company->name, sizeof(record->name));
+            strncpy(record->category, getCategoryName(company->category), sizeof(record->category) - 1);
+            strncpy(record->businessSector, symbolName(&sectorSymbols, company->sectorId), sizeof(record->businessSector) - 1);
+            memcpy(record->street, company->street, sizeof(record->street));
+            strncpy(record->locality, symbolName(&localitySymbols, company->localityId), sizeof(record->locality) - 1);
+            memcpy(record->postalCode, company->postalCode, sizeof(record->postalCode));
+            memcpy(record->activity, company->activity, sizeof(record->activity));
+        }
+
+        char tempPath[] = SNAPSHOT_FILE ".tmp";
+        FILE *file = fopen(tempPath, "wb");
+        int ok = file != NULL && fwrite(buffer, 1, size, file) == size;
+
+        if (file != NULL) {
+            ok = fclose(file) == 0 && ok;
+        }
+        free(buffer);
+
+        if (!ok || rename(tempPath, SNAPSHOT_FILE) != 0) {
+            printf("Error writing %s.\n", SNAPSHOT_FILE);
+            remove(tempPath);
+            return 0;
+        }
+        return 1;
+    }
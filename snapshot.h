@@ -0,0 +1,105 @@
+/**
+ * @file snapshot.h
+ * @brief Header file for the catalog snapshot of the Company Management System.
+ *
+ * The snapshot is a single checkpoint file holding the companies as they are kept in memory,
+ * with their comment counts and rating aggregates, so that everything is loaded with one
+ * sequential read:
+ *
+ *   [SnapshotHeader][SnapshotCompany x numCompanies]
+ *
+ * The comments and the rating history are not part of it; they stay in the comment log and
+ * the rating journal.
+ *
+ * It is written when the program exits. The header records the generation of the company store
+ * and the sizes of the rating journal and the comment log at that moment; if any of them changed
+ * since, the snapshot is ignored and the catalog is loaded from those files instead.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Name of the snapshot file.
+     */
+    #define SNAPSHOT_FILE "snapshot.bin"
+
+    /**
+     * @brief Magic number at the start of the snapshot ("SN01").
+     */
+    #define SNAPSHOT_MAGIC 0x31304e53u
+
+    /**
+     * @brief Current version of the snapshot layout.
+     */
+    #define SNAPSHOT_VERSION 4
+
+    /**
+     * @brief Header at the start of the snapshot.
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t companySize;
+        uint32_t numCompanies;
+        uint32_t storeGeneration;
+        uint64_t journalSize;
+        uint64_t commentLogSize;
+    } SnapshotHeader;
+
+    /**
+     * @brief One company in the snapshot.
+     */
+    typedef struct {
+        int32_t nif;
+        int32_t active;
+        int32_t storeSlot;
+        int32_t numComments;
+        int32_t numRatings;
+        int32_t ratingHistogram[MAX_RATING - MIN_RATING + 1];
+        double ratingSum;
+        double ratingSumOfSquares;
+        char name[100];
+        char category[100];
+        char businessSector[100];  // as long as a sector name can be, so it is never cut
+        char street[50];
+        char locality[100];
+        char postalCode[10];
+        char activity[100];
+    } SnapshotCompany;
+
+    /**
+     * @brief Loads the catalog, using the snapshot when it is current.
+     *
+     * When the snapshot is missing or out of date, the companies are loaded from the store,
+     * then their comments are counted in the comment log and their ratings replayed from the
+     * rating journal.
+     *
+     * @param companies The company table.
+     * @return 1 if the snapshot was used, 0 otherwise.
+     */
+    int loadCatalog(CompanyTable* companies);
+
+    /**
+     * @brief Writes a snapshot of the catalog.
+     *
+     * @param companies The company table.
+     * @return 1 on success, 0 on failure.
+     */
+    int saveSnapshot(const CompanyTable* companies);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAPSHOT_H */
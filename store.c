@@ -0,0 +1,498 @@
+/**
+ * @file store.c
+ * @brief source file for the binary company store of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "store.h"
+#include "companytable.h"
+#include "textscan.h"
+#include "symbols.h"
+
+    static size_t storeHeapStart(const StoreHeader *header) {
+        return sizeof(StoreHeader) + (size_t) header->capacity * sizeof(StoreRecord);
+    }
+
+    static int isValidStoreHeader(const StoreHeader *header, size_t fileSize) {
+        return header->magic == STORE_MAGIC && header->version == STORE_VERSION &&
+                header->recordSize == sizeof(StoreRecord) && header->numRecords <= header->capacity &&
+                storeHeapStart(header) + header->heapSize <= fileSize;
+    }
+
+    static void copyStoreString(char *dest, size_t size, const char *heap, const StoreHeader *header, StoreString string) {
+        if ((size_t) string.offset + string.length > header->heapSize) {
+            dest[0] = '\0';
+            return;
+        }
+
+        size_t length = string.length < size - 1 ? string.length : size - 1;
+        memcpy(dest, heap + string.offset, length);
+        dest[length] = '\0';
+    }
+
+    static int writeAt(int fd, const void *buffer, size_t length, off_t offset) {
+        const char *bytes = buffer;
+
+        while (length > 0) {
+            ssize_t written = pwrite(fd, bytes, length, offset);
+            if (written <= 0) {
+                return 0;
+            }
+            bytes += written;
+            length -= written;
+            offset += written;
+        }
+        return 1;
+    }
+
+    static int readAt(int fd, void *buffer, size_t length, off_t offset) {
+        return pread(fd, buffer, length, offset) == (ssize_t) length;
+    }
+
+    static uint32_t storeStringSpace(const StoreRecord *record) {
+        return record->name.length + record->category.length + record->businessSector.length +
+                record->street.length + record->locality.length + record->postalCode.length +
+                record->activity.length + 7;
+    }
+
+    static StoreString putString(char *heap, uint32_t *heapSize, const char *value) {
+        StoreString string = {*heapSize, (uint32_t) strlen(value)};
+
+        memcpy(heap + string.offset, value, string.length + 1);
+        *heapSize += string.length + 1;
+        return string;
+    }
+
+    static uint32_t companyStringSpace(const Company *company) {
+        return strlen(company->name) + strlen(getCategoryName(company->category)) +
+                strlen(symbolName(&sectorSymbols, company->sectorId)) + strlen(company->street) +
+                strlen(symbolName(&localitySymbols, company->localityId)) + strlen(company->postalCode) +
+                strlen(company->activity) + 7;
+    }
+
+    static StoreRecord makeStoreRecord(const Company *company, char *heap, uint32_t *heapSize) {
+        StoreRecord record;
+
+        record.nif = company->nif;
+        record.flags = STORE_RECORD_LIVE | (company->active ? STORE_RECORD_ACTIVE : 0);
+        record.name = putString(heap, heapSize, company->name);
+        record.category = putString(heap, heapSize, getCategoryName(company->category));
+        record.businessSector = putString(heap, heapSize, symbolName(&sectorSymbols, company->sectorId));
+        record.street = putString(heap, heapSize, company->street);
+        record.locality = putString(heap, heapSize, symbolName(&localitySymbols, company->localityId));
+        record.postalCode = putString(heap, heapSize, company->postalCode);
+        record.activity = putString(heap, heapSize, company->activity);
+        return record;
+    }
+
+    /*
+     * Writes a complete store holding every company of the table, then swaps it in.
+     * Slots are reassigned in listing order and the heap ends up without garbage.
+     */
+    static int writeStoreFile(const char *path, CompanyTable *companies, uint32_t generation) {
+        StoreHeader header = {STORE_MAGIC, STORE_VERSION, sizeof(StoreRecord), 0, STORE_INITIAL_CAPACITY, 0, 0, generation};
+
+        while (header.capacity < (uint32_t) companies->count * 2) {
+            header.capacity *= 2;
+        }
+
+        size_t heapCapacity = 0;
+        for (int i = 0; i < companies->count; i++) {
+            heapCapacity += companyStringSpace(companyAt(companies, i));
+        }
+
+        size_t fileSize = storeHeapStart(&header) + heapCapacity;
+        char *buffer = calloc(1, fileSize);
+
+        if (buffer == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        StoreRecord *records = (StoreRecord *) (buffer + sizeof(StoreHeader));
+        char *heap = buffer + storeHeapStart(&header);
+
+        for (int i = 0; i < companies->count; i++) {
+            records[i] = makeStoreRecord(companyAt(companies, i), heap, &header.heapSize);
+        }
+        header.numRecords = companies->count;
+        memcpy(buffer, &header, sizeof(StoreHeader));
+
+        char tempPath[256];
+        snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+        FILE *file = fopen(tempPath, "wb");
+        if (file == NULL) {
+            printf("Error opening file for writing.\n");
+            free(buffer);
+            return 0;
+        }
+
+        int ok = fwrite(buffer, 1, fileSize, file) == fileSize;
+        ok = fclose(file) == 0 && ok;
+        free(buffer);
+
+        if (!ok || rename(tempPath, path) != 0) {
+            printf("Error writing %s.\n", path);
+            remove(tempPath);
+            return 0;
+        }
+
+        for (int i = 0; i < companies->count; i++) {
+            companyAt(companies, i)->storeSlot = i;
+            companyAt(companies, i)->dirty = 0;
+        }
+        return 1;
+    }
+
+    static int openStore(StoreHeader *header) {
+        int fd = open(STORE_FILE, O_RDWR);
+        struct stat st;
+
+        if (fd < 0) {
+            return -1;
+        }
+
+        if (fstat(fd, &st) != 0 || !readAt(fd, header, sizeof(StoreHeader), 0) ||
+                !isValidStoreHeader(header, st.st_size)) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    int loadCompaniesFromStore(CompanyTable *companies) {
+        int fd = open(STORE_FILE, O_RDONLY);
+        struct stat st;
+
+        clearCompanyTable(companies);
+
+        // A missing or empty store is created from the legacy text file, if there is one.
+        if (fd < 0 || fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(StoreHeader)) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            if (convertCompaniesTextToStore(STORE_LEGACY_FILE, STORE_FILE) < 0) {
+                return 0;
+            }
+            fd = open(STORE_FILE, O_RDONLY);
+            if (fd < 0 || fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(StoreHeader)) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+                return 0;
+            }
+        }
+
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            printf("Error mapping %s.\n", STORE_FILE);
+            return 0;
+        }
+
+        const StoreHeader *header = map;
+        if (!isValidStoreHeader(header, st.st_size)) {
+            printf("Invalid or unsupported %s.\n", STORE_FILE);
+            munmap(map, st.st_size);
+            return 0;
+        }
+
+        const StoreRecord *records = (const StoreRecord *) (header + 1);
+        const char *heap = (const char *) map + storeHeapStart(header);
+        char value[100];
+        int count = 0;
+
+        for (uint32_t i = 0; i < header->numRecords; i++) {
+            const StoreRecord *record = &records[i];
+
+            if (!(record->flags & STORE_RECORD_LIVE)) {
+                continue;
+            }
+
+            Company *company = addCompany(companies);
+            if (company == NULL) {
+                break;
+            }
+
+            company->nif = record->nif;
+            setCompanyActive(companies, company, record->flags & STORE_RECORD_ACTIVE);
+            copyStoreString(value, sizeof(value), heap, header, record->name);
+            setCompanyName(company, value);
+            copyStoreString(value, sizeof(value), heap, header, record->category);
+            company->category = parseCategory(value);
+            copyStoreString(value, sizeof(value), heap, header, record->businessSector);
+            setCompanySector(companies, company, internSymbol(&sectorSymbols, value));
+            copyStoreString(company->street, sizeof(company->street), heap, header, record->street);
+            copyStoreString(value, sizeof(value), heap, header, record->locality);
+            setCompanyLocality(company, value);
+            copyStoreString(value, sizeof(value), heap, header, record->postalCode);
+            setCompanyPostalCode(company, value);
+            copyStoreString(company->activity, sizeof(company->activity), heap, header, record->activity);
+            company->storeSlot = i;
+            company->dirty = 0;
+
+            // A record whose NIF is already loaded is left out, so every company in the table can
+            // be found by its NIF; its slot is freed in the store so it is reported only once.
+            if (!indexCompanyNif(companies, company)) {
+                printf("Skipping record %u of %s: duplicate NIF %d.\n", i, STORE_FILE, company->nif);
+                removeCompanyFromTable(companies, company);
+                removeCompanyFromStore(i);
+                continue;
+            }
+            count++;
+        }
+
+        munmap(map, st.st_size);
+        return count;
+    }
+
+    int saveDirtyCompaniesToStore(CompanyTable *companies) {
+        StoreHeader header;
+        int fd = openStore(&header);
+
+        if (fd < 0) {
+            return writeStoreFile(STORE_FILE, companies, 1);
+        }
+
+        int pending = 0;
+        int numDirty = 0;
+        uint32_t heapNeeded = 0;
+        for (int i = 0; i < companies->count; i++) {
+            const Company *company = companyAt(companies, i);
+            if (company->dirty) {
+                heapNeeded += companyStringSpace(company);
+                numDirty++;
+                if (company->storeSlot < 0) {
+                    pending++;
+                }
+            }
+        }
+
+        if (heapNeeded == 0) {
+            close(fd);
+            return 1;
+        }
+
+        StoreRecord *records = malloc((header.numRecords + 1) * sizeof(StoreRecord));
+        if (records == NULL || !readAt(fd, records, header.numRecords * sizeof(StoreRecord), sizeof(StoreHeader))) {
+            free(records);
+            close(fd);
+            return writeStoreFile(STORE_FILE, companies, header.generation + 1);
+        }
+
+        int freeSlots = header.capacity - header.numRecords;
+        for (uint32_t i = 0; i < header.numRecords; i++) {
+            if (!(records[i].flags & STORE_RECORD_LIVE)) {
+                freeSlots++;
+            }
+        }
+
+        // Compact instead of growing the heap forever or running out of slots.
+        if (pending > freeSlots || (header.heapGarbage > 4096 && header.heapGarbage > header.heapSize / 2)) {
+            free(records);
+            close(fd);
+            return writeStoreFile(STORE_FILE, companies, header.generation + 1);
+        }
+
+        char *heap = malloc(heapNeeded);
+        StoreRecord *changed = malloc(numDirty * sizeof(StoreRecord));
+        int *changedSlots = malloc(numDirty * sizeof(int));
+        uint32_t heapStart = header.heapSize;
+        uint32_t nextFree = 0;
+        int numChanged = 0;
+        int ok = heap != NULL && changed != NULL && changedSlots != NULL;
+
+        for (int i = 0; ok && i < companies->count; i++) {
+            const Company *company = companyAt(companies, i);
+
+            if (!company->dirty) {
+                continue;
+            }
+
+            int slot = company->storeSlot;
+            if (slot >= 0 && (uint32_t) slot < header.numRecords) {
+                header.heapGarbage += storeStringSpace(&records[slot]);
+            } else {
+                while (nextFree < header.numRecords && (records[nextFree].flags & STORE_RECORD_LIVE)) {
+                    nextFree++;
+                }
+                slot = nextFree++;
+                if ((uint32_t) slot >= header.numRecords) {
+                    header.numRecords = slot + 1;
+                }
+            }
+
+            uint32_t offset = header.heapSize - heapStart;
+            StoreRecord *record = &changed[numChanged];
+            *record = makeStoreRecord(company, heap, &offset);
+            StoreString *fields[] = {&record->name, &record->category, &record->businessSector, &record->street,
+                &record->locality, &record->postalCode, &record->activity};
+            for (size_t f = 0; f < sizeof(fields) / sizeof(fields[0]); f++) {
+                fields[f]->offset += heapStart;
+            }
+            header.heapSize = heapStart + offset;
+            changedSlots[numChanged++] = slot;
+        }
+
+        // Strings go to disk before the records that point to them, and the records before the
+        // header that makes them reachable, so a failed save leaves the old store readable.
+        ok = ok && writeAt(fd, heap, header.heapSize - heapStart, storeHeapStart(&header) + heapStart);
+        for (int i = 0; ok && i < numChanged; i++) {
+            ok = writeAt(fd, &changed[i], sizeof(StoreRecord), sizeof(StoreHeader) + (off_t) changedSlots[i] * sizeof(StoreRecord));
+        }
+        header.generation++;
+        ok = ok && writeAt(fd, &header, sizeof(StoreHeader), 0);
+
+        // The companies stay dirty unless the whole save went through, so the next save retries them.
+        if (ok) {
+            for (int i = 0, next = 0; i < companies->count; i++) {
+                Company *company = companyAt(companies, i);
+                if (company->dirty) {
+                    company->storeSlot = changedSlots[next++];
+                    company->dirty = 0;
+                }
+            }
+        }
+
+        free(changedSlots);
+        free(changed);
+        free(heap);
+        free(records);
+        close(fd);
+
+        if (!ok) {
+            printf("Error writing %s.\n", STORE_FILE);
+        }
+        return ok;
+    }
+
+    int removeCompanyFromStore(int storeSlot) {
+        StoreHeader header;
+        StoreRecord record;
+        int fd = openStore(&header);
+
+        if (fd < 0) {
+            return 0;
+        }
+
+        off_t offset = sizeof(StoreHeader) + (off_t) storeSlot * sizeof(StoreRecord);
+        int ok = storeSlot >= 0 && (uint32_t) storeSlot < header.numRecords && readAt(fd, &record, sizeof(record), offset);
+
+        if (ok && (record.flags & STORE_RECORD_LIVE)) {
+            header.heapGarbage += storeStringSpace(&record);
+            record.flags = 0;
+            header.generation++;
+            ok = writeAt(fd, &record, sizeof(record), offset) && writeAt(fd, &header, sizeof(StoreHeader), 0);
+        }
+
+        close(fd);
+        return ok;
+    }
+
+    int convertCompaniesTextToStore(const char* textPath, const char* storePath) {
+        TextScanner scanner;
+
+        if (!openTextScanner(&scanner, textPath)) {
+            return -1;
+        }
+
+        CompanyTable parsed;
+        Company *current = NULL;
+        int failed = 0;
+        TextToken field;
+        TextToken value;
+        char text[100];
+
+        memset(&parsed, 0, sizeof(parsed));
+        while (!failed && nextLine(&scanner, NULL)) {
+            if (atLineEnd(&scanner)) {
+                continue;
+            }
+
+            if (scanLiteral(&scanner, "Company ")) {
+                current = addCompany(&parsed);
+                failed = current == NULL;
+                if (current != NULL) {
+                    setCompanyActive(&parsed, current, 1);
+                }
+                continue;
+            }
+
+            if (!scanUntil(&scanner, ':', &field)) {
+                reportScanError(&scanner, field.start, "expected \"Field: value\"");
+                continue;
+            }
+            scanLiteral(&scanner, " ");
+            scanRest(&scanner, &value);
+
+            if (current == NULL) {
+                reportScanError(&scanner, field.start, "field before the first \"Company\" line");
+            } else if (tokenEquals(field, "NIF")) {
+                if (!tokenToInt(value, &current->nif)) {
+                    reportScanError(&scanner, value.start, "invalid NIF");
+                }
+            } else if (tokenEquals(field, "Name")) {
+                copyToken(text, sizeof(text), value);
+                setCompanyName(current, text);
+            } else if (tokenEquals(field, "Category")) {
+                copyToken(text, sizeof(text), value);
+                current->category = parseCategory(text);
+                if (current->category == 0) {
+                    reportScanError(&scanner, value.start, "unknown category");
+                }
+            } else if (tokenEquals(field, "Business Sector")) {
+                copyToken(text, sizeof(text), value);
+                setCompanySector(&parsed, current, internSymbol(&sectorSymbols, text));
+            } else if (tokenEquals(field, "Street")) {
+                copyToken(current->street, sizeof(current->street), value);
+            } else if (tokenEquals(field, "Locality")) {
+                copyToken(text, sizeof(text), value);
+                setCompanyLocality(current, text);
+            } else if (tokenEquals(field, "Postal Code")) {
+                copyToken(text, sizeof(text), value);
+                setCompanyPostalCode(current, text);
+            } else if (tokenEquals(field, "Active")) {
+                int active;
+                if (!tokenToInt(value, &active)) {
+                    reportScanError(&scanner, value.start, "invalid status");
+                } else {
+                    setCompanyActive(&parsed, current, active);
+                }
+            } else {
+                reportScanError(&scanner, field.start, "unknown field");
+            }
+        }
+
+        closeTextScanner(&scanner);
+
+        int count = parsed.count;
+        int ok = !failed && writeStoreFile(storePath, &parsed, 1);
+        freeCompanyTable(&parsed);
+
+        if (!ok) {
+            return -1;
+        }
+
+        printf("Converted %d companies from %s to %s.\n", count, textPath, storePath);
+        return count;
+    }
+
+    uint32_t getStoreGeneration() {
+        StoreHeader header;
+        int fd = openStore(&header);
+
+        if (fd < 0) {
+            return 0;
+        }
+        close(fd);
+        return header.generation;
+    }
@@ -0,0 +1,152 @@
+/**
+ * @file store.h
+ * @brief Header file for the binary company store of the Company Management System.
+ *
+ * The store replaces the old companies.txt text format. It is a versioned file with a fixed
+ * layout that can be mapped into memory and read without any parsing:
+ *
+ *   [StoreHeader][StoreRecord x capacity][string heap]
+ *
+ * Every record points into the string heap, where the text fields are kept NUL-terminated.
+ * Saving only writes the records that changed: their strings are appended to the heap and
+ * the record slot is overwritten in place. The file is rewritten (and compacted) only when
+ * the record table is full or the heap holds too many stale strings.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef STORE_H
+#define STORE_H
+
+#include <stdint.h>
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Name of the binary company store.
+     */
+    #define STORE_FILE "companies.bin"
+
+    /**
+     * @brief Name of the legacy text file converted into the store.
+     */
+    #define STORE_LEGACY_FILE "companies.txt"
+
+    /**
+     * @brief Magic number at the start of the store ("C360").
+     */
+    #define STORE_MAGIC 0x30363343u
+
+    /**
+     * @brief Current version of the store layout.
+     */
+    #define STORE_VERSION 1
+
+    /**
+     * @brief Number of record slots reserved when a store is created.
+     */
+    #define STORE_INITIAL_CAPACITY 64
+
+    /**
+     * @brief Record flag: the slot holds a company.
+     */
+    #define STORE_RECORD_LIVE 0x1
+
+    /**
+     * @brief Record flag: the company is active.
+     */
+    #define STORE_RECORD_ACTIVE 0x2
+
+    /**
+     * @brief Header at the start of the store.
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t numRecords;    // slots in use, including freed ones below the high-water mark
+        uint32_t capacity;      // slots reserved in the record table
+        uint32_t heapSize;      // bytes used in the string heap
+        uint32_t heapGarbage;   // bytes of the heap no longer referenced by any record
+        uint32_t generation;    // incremented on every save
+    } StoreHeader;
+
+    /**
+     * @brief Reference to a string in the heap.
+     */
+    typedef struct {
+        uint32_t offset;
+        uint32_t length;
+    } StoreString;
+
+    /**
+     * @brief Fixed-size record describing one company.
+     */
+    typedef struct {
+        int32_t nif;
+        uint32_t flags;
+        StoreString name;
+        StoreString category;
+        StoreString businessSector;
+        StoreString street;
+        StoreString locality;
+        StoreString postalCode;
+        StoreString activity;
+    } StoreRecord;
+
+    /**
+     * @brief Loads the companies of the store into the company table.
+     *
+     * The store is mapped into memory and the records are copied out without any parsing.
+     * If the store does not exist but the legacy companies.txt does, it is converted first.
+     * The table is cleared first. A record with the NIF of a record already loaded is reported
+     * and left out.
+     *
+     * @param companies The company table.
+     * @return The number of companies loaded.
+     */
+    int loadCompaniesFromStore(CompanyTable* companies);
+
+    /**
+     * @brief Writes the companies marked as dirty to the store.
+     *
+     * Companies without a slot are given one; the dirty flag is cleared once written.
+     *
+     * @param companies The company table.
+     * @return 1 on success, 0 on failure.
+     */
+    int saveDirtyCompaniesToStore(CompanyTable* companies);
+
+    /**
+     * @brief Frees the slot of a company in the store.
+     *
+     * @param storeSlot The slot of the company.
+     * @return 1 on success, 0 on failure.
+     */
+    int removeCompanyFromStore(int storeSlot);
+
+    /**
+     * @brief Converts the legacy companies.txt file into a new store.
+     *
+     * @param textPath Path of the legacy text file.
+     * @param storePath Path of the store to be created.
+     * @return The number of companies converted, or -1 on failure.
+     */
+    int convertCompaniesTextToStore(const char* textPath, const char* storePath);
+
+    /**
+     * @brief Gets the generation of the store, incremented on every save.
+     *
+     * @return The generation, or 0 if there is no store.
+     */
+    uint32_t getStoreGeneration();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STORE_H */
@@ -0,0 +1,128 @@
+/**
+ * @file symbols.c
+ * @brief source file for the symbol tables of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "symbols.h"
+
+/**
+ * @brief The business sectors and the localities used by the companies.
+ */
+SymbolTable sectorSymbols;
+SymbolTable localitySymbols;
+
+    static unsigned int symbolHash(const char *name) {
+        unsigned int hash = 2166136261u;
+
+        for (const unsigned char *p = (const unsigned char *) name; *p != '\0'; p++) {
+            hash = (hash ^ *p) * 16777619u;
+        }
+        return hash;
+    }
+
+    static int growBuckets(SymbolTable *table) {
+        int numBuckets = table->numBuckets > 0 ? table->numBuckets * 2 : 64;
+        int *buckets = calloc(numBuckets, sizeof(int));
+
+        if (buckets == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+
+        for (int id = 0; id < table->count; id++) {
+            unsigned int i = symbolHash(table->names[id]) & (numBuckets - 1);
+            while (buckets[i] != 0) {
+                i = (i + 1) & (numBuckets - 1);
+            }
+            buckets[i] = id + 1;
+        }
+
+        free(table->buckets);
+        table->buckets = buckets;
+        table->numBuckets = numBuckets;
+        return 1;
+    }
+
+    int findSymbol(const SymbolTable *table, const char *name) {
+        if (table->numBuckets == 0) {
+            return -1;
+        }
+
+        unsigned int i = symbolHash(name) & (table->numBuckets - 1);
+        while (table->buckets[i] != 0) {
+            int id = table->buckets[i] - 1;
+            if (strcmp(table->names[id], name) == 0) {
+                return id;
+            }
+            i = (i + 1) & (table->numBuckets - 1);
+        }
+        return -1;
+    }
+
+    int internSymbol(SymbolTable *table, const char *name) {
+        int id = findSymbol(table, name);
+
+        if (id >= 0) {
+            return id;
+        }
+
+        if ((table->count + 1) * 2 > table->numBuckets && !growBuckets(table)) {
+            return -1;
+        }
+        if (table->count == table->capacity) {
+            int capacity = table->capacity > 0 ? table->capacity * 2 : INITIAL_BUFFER_SIZE;
+            char **names = realloc(table->names, capacity * sizeof(char *));
+            if (names == NULL) {
+                printf("Memory allocation error.\n");
+                return -1;
+            }
+            table->names = names;
+            table->capacity = capacity;
+        }
+
+        char *copy = malloc(strlen(name) + 1);
+        if (copy == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+        strcpy(copy, name);
+
+        id = table->count++;
+        table->names[id] = copy;
+
+        unsigned int i = symbolHash(name) & (table->numBuckets - 1);
+        while (table->buckets[i] != 0) {
+            i = (i + 1) & (table->numBuckets - 1);
+        }
+        table->buckets[i] = id + 1;
+        return id;
+    }
+
+    const char *symbolName(const SymbolTable *table, int id) {
+        return id >= 0 && id < table->count ? table->names[id] : "";
+    }
+
+    void truncateSymbols(SymbolTable *table, int count) {
+        if (count < 0 || count >= table->count) {
+            return;
+        }
+
+        for (int id = count; id < table->count; id++) {
+            free(table->names[id]);
+        }
+        table->count = count;
+
+        // Open addressing has no deletion, so the kept ids are hashed again.
+        memset(table->buckets, 0, table->numBuckets * sizeof(int));
+        for (int id = 0; id < count; id++) {
+            unsigned int i = symbolHash(table->names[id]) & (table->numBuckets - 1);
+            while (table->buckets[i] != 0) {
+                i = (i + 1) & (table->numBuckets - 1);
+            }
+            table->buckets[i] = id + 1;
+        }
+    }
@@ -0,0 +1,83 @@
+/**
+ * @file symbols.h
+ * @brief Header file for the symbol tables of the Company Management System.
+ *
+ * Business sectors and localities repeat across many companies, so each distinct value is
+ * stored once in a symbol table and the companies keep its small integer id. Comparing two
+ * values is then an integer comparison. The ids only live in memory; the store and the
+ * snapshot keep the text.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Structure representing a table of interned strings.
+     */
+    typedef struct {
+        char** names;      // the strings, by id
+        int count;
+        int capacity;
+        int* buckets;      // open-addressing hash of id + 1, 0 for an empty bucket
+        int numBuckets;    // a power of two
+    } SymbolTable;
+
+    /**
+     * @brief Gets the id of a string, adding it to the table if it is not there yet.
+     *
+     * @param table The symbol table.
+     * @param name The string.
+     * @return The id of the string, or -1 if memory could not be allocated.
+     */
+    int internSymbol(SymbolTable* table, const char* name);
+
+    /**
+     * @brief Gets the id of a string without adding it.
+     *
+     * @param table The symbol table.
+     * @param name The string.
+     * @return The id of the string, or -1 if it is not in the table.
+     */
+    int findSymbol(const SymbolTable* table, const char* name);
+
+    /**
+     * @brief Gets the string of an id.
+     *
+     * @param table The symbol table.
+     * @param id The id.
+     * @return The string, or an empty string if the id is not in the table.
+     */
+    const char* symbolName(const SymbolTable* table, int id);
+
+    /**
+     * @brief Removes the strings added after the table held a number of them.
+     *
+     * Used to undo the strings interned by an operation that failed; their ids must no longer
+     * be in use.
+     *
+     * @param table The symbol table.
+     * @param count The number of strings to keep.
+     * @return void - This function does not return a value.
+     */
+    void truncateSymbols(SymbolTable* table, int count);
+
+    /**
+     * @brief External declarations for the symbol tables of the business sectors and the localities.
+     */
+    extern SymbolTable sectorSymbols;
+    extern SymbolTable localitySymbols;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYMBOLS_H */
@@ -0,0 +1,318 @@
+/**
+ * @file textcolumn.c
+ * @brief source file for the packed text columns scanned by the searches of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "textcolumn.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEXTCOLUMN_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Signature of the substring search kernels.
+ */
+typedef const char *(*SubstringKernel)(const char *text, size_t length, const char *term, size_t termLength);
+
+/**
+ * @brief The kernel chosen for this processor, set on the first search.
+ */
+static SubstringKernel substringKernel = NULL;
+static const char *substringKernelName = NULL;
+
+    static const char *findSubstringScalar(const char *text, size_t length, const char *term, size_t termLength) {
+        const char *end = text + length;
+
+        if (termLength == 0) {
+            return text;
+        }
+
+        while ((size_t) (end - text) >= termLength) {
+            const char *found = memchr(text, term[0], end - text - termLength + 1);
+
+            if (found == NULL) {
+                return NULL;
+            }
+            if (found[termLength - 1] == term[termLength - 1] && memcmp(found, term, termLength) == 0) {
+                return found;
+            }
+            text = found + 1;
+        }
+        return NULL;
+    }
+
+#ifdef TEXTCOLUMN_X86
+    /*
+     * Compares 16 positions per step: a position is a candidate only if the first byte of the
+     * term is there and its last byte is termLength - 1 bytes further.
+     */
+    __attribute__((target("sse2")))
+    static const char *findSubstringSse2(const char *text, size_t length, const char *term, size_t termLength) {
+        if (termLength == 0 || termLength > length) {
+            return termLength == 0 ? text : NULL;
+        }
+
+        const __m128i first = _mm_set1_epi8(term[0]);
+        const __m128i last = _mm_set1_epi8(term[termLength - 1]);
+        size_t i = 0;
+
+        for (; i + termLength - 1 + 16 <= length; i += 16) {
+            __m128i blockFirst = _mm_loadu_si128((const __m128i *) (text + i));
+            __m128i blockLast = _mm_loadu_si128((const __m128i *) (text + i + termLength - 1));
+            unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+                    _mm_cmpeq_epi8(last, blockLast)));
+
+            while (mask != 0) {
+                int bit = __builtin_ctz(mask);
+                if (termLength <= 2 || memcmp(text + i + bit + 1, term + 1, termLength - 2) == 0) {
+                    return text + i + bit;
+                }
+                mask &= mask - 1;
+            }
+        }
+        return findSubstringScalar(text + i, length - i, term, termLength);
+    }
+
+    __attribute__((target("avx2")))
+    static const char *findSubstringAvx2(const char *text, size_t length, const char *term, size_t termLength) {
+        if (termLength == 0 || termLength > length) {
+            return termLength == 0 ? text : NULL;
+        }
+
+        const __m256i first = _mm256_set1_epi8(term[0]);
+        const __m256i last = _mm256_set1_epi8(term[termLength - 1]);
+        size_t i = 0;
+
+        for (; i + termLength - 1 + 32 <= length; i += 32) {
+            __m256i blockFirst = _mm256_loadu_si256((const __m256i *) (text + i));
+            __m256i blockLast = _mm256_loadu_si256((const __m256i *) (text + i + termLength - 1));
+            unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+                    _mm256_cmpeq_epi8(last, blockLast)));
+
+            while (mask != 0) {
+                int bit = __builtin_ctz(mask);
+                if (termLength <= 2 || memcmp(text + i + bit + 1, term + 1, termLength - 2) == 0) {
+                    return text + i + bit;
+                }
+                mask &= mask - 1;
+            }
+        }
+        return findSubstringSse2(text + i, length - i, term, termLength);
+    }
+#endif
+
+    static void chooseSubstringKernel() {
+        substringKernel = findSubstringScalar;
+        substringKernelName = "scalar";
+
+#ifdef TEXTCOLUMN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            substringKernel = findSubstringAvx2;
+            substringKernelName = "AVX2";
+        } else if (__builtin_cpu_supports("sse2")) {
+            substringKernel = findSubstringSse2;
+            substringKernelName = "SSE2";
+        }
+#endif
+    }
+
+    const char *findSubstring(const char *text, size_t length, const char *term, size_t termLength) {
+        if (substringKernel == NULL) {
+            chooseSubstringKernel();
+        }
+        return substringKernel(text, length, term, termLength);
+    }
+
+    const char *getSubstringKernelName() {
+        if (substringKernel == NULL) {
+            chooseSubstringKernel();
+        }
+        return substringKernelName;
+    }
+
+    static int reserveColumnSlot(TextColumn *column, int slot) {
+        if (slot < column->slotCapacity) {
+            return 1;
+        }
+
+        int capacity = column->slotCapacity > 0 ? column->slotCapacity : INITIAL_BUFFER_SIZE;
+        while (capacity <= slot) {
+            capacity *= 2;
+        }
+
+        int *rowBySlot = realloc(column->rowBySlot, capacity * sizeof(int));
+        if (rowBySlot == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        for (int i = column->slotCapacity; i < capacity; i++) {
+            rowBySlot[i] = -1;
+        }
+        column->rowBySlot = rowBySlot;
+        column->slotCapacity = capacity;
+        return 1;
+    }
+
+    /*
+     * Moves the rows still in use to the front of the buffer, dropping the removed ones.
+     */
+    static void compactTextColumn(TextColumn *column) {
+        size_t length = 0;
+        int numRows = 0;
+
+        for (int row = 0; row < column->numRows; row++) {
+            if (column->slots[row] < 0) {
+                continue;
+            }
+
+            size_t end = row + 1 < column->numRows ? column->offsets[row + 1] : column->length;
+            memmove(column->bytes + length, column->bytes + column->offsets[row], end - column->offsets[row]);
+
+            column->offsets[numRows] = length;
+            column->slots[numRows] = column->slots[row];
+            column->rowBySlot[column->slots[row]] = numRows;
+            length += end - column->offsets[row];
+            numRows++;
+        }
+
+        column->length = length;
+        column->numRows = numRows;
+        column->blankBytes = 0;
+    }
+
+    int addColumnText(TextColumn *column, int slot, const char *text) {
+        size_t size = strlen(text) + 1;
+
+        removeColumnText(column, slot);
+        if (!reserveColumnSlot(column, slot)) {
+            return 0;
+        }
+
+        if (column->length + size > column->capacity) {
+            size_t capacity = column->capacity > 0 ? column->capacity : 4096;
+            while (capacity < column->length + size) {
+                capacity *= 2;
+            }
+
+            char *bytes = realloc(column->bytes, capacity);
+            if (bytes == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            column->bytes = bytes;
+            column->capacity = capacity;
+        }
+
+        if (column->numRows == column->rowCapacity) {
+            int capacity = column->rowCapacity > 0 ? column->rowCapacity * 2 : INITIAL_BUFFER_SIZE;
+            size_t *offsets = realloc(column->offsets, capacity * sizeof(size_t));
+            int *slots = offsets != NULL ? realloc(column->slots, capacity * sizeof(int)) : NULL;
+
+            if (offsets != NULL) {
+                column->offsets = offsets;
+            }
+            if (slots == NULL) {
+                printf("Memory allocation error.\n");
+                return 0;
+            }
+            column->slots = slots;
+            column->rowCapacity = capacity;
+        }
+
+        memcpy(column->bytes + column->length, text, size);
+        column->offsets[column->numRows] = column->length;
+        column->slots[column->numRows] = slot;
+        column->rowBySlot[slot] = column->numRows;
+        column->numRows++;
+        column->length += size;
+        return 1;
+    }
+
+    void removeColumnText(TextColumn *column, int slot) {
+        if (slot < 0 || slot >= column->slotCapacity || column->rowBySlot[slot] < 0) {
+            return;
+        }
+
+        int row = column->rowBySlot[slot];
+        size_t end = row + 1 < column->numRows ? column->offsets[row + 1] : column->length;
+
+        // Blanked bytes can no longer match, so the row stays in place until the next compaction.
+        memset(column->bytes + column->offsets[row], 0, end - column->offsets[row]);
+        column->slots[row] = -1;
+        column->rowBySlot[slot] = -1;
+        column->blankBytes += end - column->offsets[row];
+
+        if (column->blankBytes > 4096 && column->blankBytes * 2 > column->length) {
+            compactTextColumn(column);
+        }
+    }
+
+    static int findRow(const TextColumn *column, size_t offset) {
+        int low = 0;
+        int high = column->numRows - 1;
+
+        // Last row starting at or before the offset
+        while (low < high) {
+            int middle = (low + high + 1) / 2;
+            if (column->offsets[middle] <= offset) {
+                low = middle;
+            } else {
+                high = middle - 1;
+            }
+        }
+        return low;
+    }
+
+    static int compareSlots(const void *a, const void *b) {
+        int x = *(const int *) a;
+        int y = *(const int *) b;
+        return (x > y) - (x < y);
+    }
+
+    int scanTextColumn(const TextColumn *column, const char *term, int **slots) {
+        size_t termLength = strlen(term);
+        size_t position = 0;
+        int found = 0;
+
+        *slots = malloc((column->numRows + 1) * sizeof(int));
+        if (*slots == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        while (position < column->length) {
+            const char *match = findSubstring(column->bytes + position, column->length - position, term, termLength);
+            if (match == NULL) {
+                break;
+            }
+
+            int row = findRow(column, match - column->bytes);
+            if (column->slots[row] >= 0) {
+                (*slots)[found++] = column->slots[row];
+            }
+
+            // Only the first match of each row is kept; the search resumes at the next row.
+            position = row + 1 < column->numRows ? column->offsets[row + 1] : column->length;
+        }
+
+        if (found == 0) {
+            free(*slots);
+            *slots = NULL;
+        }
+        qsort(*slots, found, sizeof(int), compareSlots);
+        return found;
+    }
+
+    void freeTextColumn(TextColumn *column) {
+        free(column->bytes);
+        free(column->offsets);
+        free(column->slots);
+        free(column->rowBySlot);
+        memset(column, 0, sizeof(TextColumn));
+    }
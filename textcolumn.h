@@ -0,0 +1,105 @@
+/**
+ * @file textcolumn.h
+ * @brief Header file for the packed text columns scanned by the searches of the Company Management System.
+ *
+ * A text column holds one text per company (such as the folded key of its name) packed one after
+ * the other in a single buffer, each followed by a NUL byte, instead of spread over the company
+ * records. Searches that no index can serve scan this buffer in one pass.
+ *
+ * The scan looks for the first and the last byte of the term at the same time, 16 or 32 positions
+ * per step with SSE2 or AVX2, and only compares the whole term where both match. The instruction
+ * set is chosen at run time from what the processor supports, with a plain C version for the
+ * others. A match never spans two texts, since a term holds no NUL byte.
+ *
+ * Texts are appended at the end of the buffer; removing one blanks it, and the buffer is compacted
+ * once blanks make up half of it.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef TEXTCOLUMN_H
+#define TEXTCOLUMN_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief A packed column of texts, one per table slot.
+     */
+    typedef struct {
+        char* bytes;        // the texts, each followed by a NUL byte
+        size_t length;
+        size_t capacity;
+        size_t blankBytes;  // bytes of removed texts
+        size_t* offsets;    // start of each row in bytes
+        int* slots;         // table slot of each row, -1 once removed
+        int numRows;
+        int rowCapacity;
+        int* rowBySlot;     // row of each table slot, -1 if it has none
+        int slotCapacity;
+    } TextColumn;
+
+    /**
+     * @brief Finds the first occurrence of a term in a buffer, like memmem.
+     *
+     * @param text The buffer.
+     * @param length The size of the buffer.
+     * @param term The term.
+     * @param termLength The size of the term.
+     * @return The position of the first occurrence, or NULL if there is none.
+     */
+    const char* findSubstring(const char* text, size_t length, const char* term, size_t termLength);
+
+    /**
+     * @brief Gets the name of the instruction set used by findSubstring.
+     *
+     * @return "AVX2", "SSE2" or "scalar".
+     */
+    const char* getSubstringKernelName();
+
+    /**
+     * @brief Sets the text of a table slot, replacing the text it had.
+     *
+     * @param column The column.
+     * @param slot The table slot.
+     * @param text The text.
+     * @return 1 on success, 0 if memory could not be allocated.
+     */
+    int addColumnText(TextColumn* column, int slot, const char* text);
+
+    /**
+     * @brief Removes the text of a table slot.
+     *
+     * @param column The column.
+     * @param slot The table slot.
+     * @return void - This function does not return a value.
+     */
+    void removeColumnText(TextColumn* column, int slot);
+
+    /**
+     * @brief Finds the table slots whose text contains a term.
+     *
+     * @param column The column.
+     * @param term The term.
+     * @param slots Receives the sorted array of slots, to be freed by the caller.
+     * @return The number of slots, or -1 on failure.
+     */
+    int scanTextColumn(const TextColumn* column, const char* term, int** slots);
+
+    /**
+     * @brief Frees the memory of a column.
+     *
+     * @param column The column.
+     * @return void - This function does not return a value.
+     */
+    void freeTextColumn(TextColumn* column);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEXTCOLUMN_H */
@@ -0,0 +1,212 @@
+/**
+ * @file textscan.c
+ * @brief source file for the tokenizer used to read the legacy text files of the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "textscan.h"
+
+    int openTextScanner(TextScanner *scanner, const char *path) {
+        int fd = open(path, O_RDONLY);
+        struct stat st;
+
+        memset(scanner, 0, sizeof(TextScanner));
+        scanner->path = path;
+
+        if (fd < 0) {
+            return 0;
+        }
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return 0;
+        }
+
+        if (st.st_size > 0) {
+            scanner->map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (scanner->map == MAP_FAILED) {
+                scanner->map = NULL;
+                close(fd);
+                printf("Error mapping %s.\n", path);
+                return 0;
+            }
+            scanner->size = st.st_size;
+        }
+        close(fd);
+
+        scanner->next = scanner->map;
+        scanner->end = scanner->next + scanner->size;
+        scanner->lineStart = scanner->lineEnd = scanner->cursor = scanner->next;
+        return 1;
+    }
+
+    void closeTextScanner(TextScanner *scanner) {
+        if (scanner->map != NULL) {
+            munmap(scanner->map, scanner->size);
+            scanner->map = NULL;
+        }
+    }
+
+    int nextLine(TextScanner *scanner, TextToken *line) {
+        if (scanner->next == NULL || scanner->next >= scanner->end) {
+            return 0;
+        }
+
+        const char *start = scanner->next;
+        const char *newline = memchr(start, '\n', scanner->end - start);
+        const char *stop = newline != NULL ? newline : scanner->end;
+
+        scanner->next = newline != NULL ? newline + 1 : scanner->end;
+        if (stop > start && stop[-1] == '\r') {
+            stop--;
+        }
+
+        scanner->lineStart = scanner->cursor = start;
+        scanner->lineEnd = stop;
+        scanner->line++;
+
+        if (line != NULL) {
+            line->start = start;
+            line->length = stop - start;
+        }
+        return 1;
+    }
+
+    int atLineEnd(const TextScanner *scanner) {
+        return scanner->cursor >= scanner->lineEnd;
+    }
+
+    int scanLiteral(TextScanner *scanner, const char *literal) {
+        size_t length = strlen(literal);
+
+        if ((size_t) (scanner->lineEnd - scanner->cursor) < length || memcmp(scanner->cursor, literal, length) != 0) {
+            return 0;
+        }
+        scanner->cursor += length;
+        return 1;
+    }
+
+    int scanUntil(TextScanner *scanner, char delimiter, TextToken *token) {
+        const char *start = scanner->cursor;
+        const char *found = memchr(start, delimiter, scanner->lineEnd - start);
+
+        token->start = start;
+        if (found == NULL) {
+            token->length = scanner->lineEnd - start;
+            scanner->cursor = scanner->lineEnd;
+            return 0;
+        }
+
+        token->length = found - start;
+        scanner->cursor = found + 1;
+        return 1;
+    }
+
+    int scanWord(TextScanner *scanner, TextToken *token) {
+        const char *p = scanner->cursor;
+
+        while (p < scanner->lineEnd && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+
+        token->start = p;
+        while (p < scanner->lineEnd && *p != ' ' && *p != '\t') {
+            p++;
+        }
+        token->length = p - token->start;
+        scanner->cursor = p;
+        return token->length > 0;
+    }
+
+    void scanRest(TextScanner *scanner, TextToken *token) {
+        const char *stop = scanner->lineEnd;
+
+        while (stop > scanner->cursor && (stop[-1] == ' ' || stop[-1] == '\t')) {
+            stop--;
+        }
+
+        token->start = scanner->cursor;
+        token->length = stop - scanner->cursor;
+        scanner->cursor = scanner->lineEnd;
+    }
+
+    int tokenToInt(TextToken token, int *value) {
+        const char *p = token.start;
+        const char *end = token.start + token.length;
+        int negative = 0;
+        long result = 0;
+
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p++ == '-';
+        }
+        if (p == end) {
+            return 0;
+        }
+
+        for (; p < end; p++) {
+            if (*p < '0' || *p > '9' || result > (INT_MAX - (*p - '0')) / 10) {
+                return 0;
+            }
+            result = result * 10 + (*p - '0');
+        }
+
+        *value = (int) (negative ? -result : result);
+        return 1;
+    }
+
+    int tokenToFloat(TextToken token, float *value) {
+        const char *p = token.start;
+        const char *end = token.start + token.length;
+        int negative = 0;
+        int digits = 0;
+        double result = 0;
+        double scale = 1;
+
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p++ == '-';
+        }
+
+        for (; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+            result = result * 10 + (*p - '0');
+        }
+        if (p < end && *p == '.') {
+            for (p++; p < end && *p >= '0' && *p <= '9'; p++, digits++) {
+                scale /= 10;
+                result += (*p - '0') * scale;
+            }
+        }
+
+        if (digits == 0 || p != end) {
+            return 0;
+        }
+
+        *value = (float) (negative ? -result : result);
+        return 1;
+    }
+
+    int tokenEquals(TextToken token, const char *text) {
+        return strlen(text) == token.length && memcmp(token.start, text, token.length) == 0;
+    }
+
+    void copyToken(char *dest, size_t size, TextToken token) {
+        size_t length = token.length < size - 1 ? token.length : size - 1;
+
+        memcpy(dest, token.start, length);
+        dest[length] = '\0';
+    }
+
+    void reportScanError(TextScanner *scanner, const char *at, const char *message) {
+        if (at < scanner->lineStart || at > scanner->lineEnd) {
+            at = scanner->cursor;
+        }
+
+        printf("%s:%d:%d: %s\n", scanner->path, scanner->line, (int) (at - scanner->lineStart) + 1, message);
+        scanner->errors++;
+    }
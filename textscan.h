@@ -0,0 +1,176 @@
+/**
+ * @file textscan.h
+ * @brief Header file for the tokenizer used to read the legacy text files of the Company Management System.
+ *
+ * The file is mapped into memory and walked with a cursor. Tokens are (pointer, length) pairs into
+ * the mapped bytes, so nothing is copied until a value is committed with copyToken or converted
+ * with tokenToInt / tokenToFloat. Fields may contain spaces. Errors are reported with the line and
+ * column where they were found.
+ *
+ * A scanner works one line at a time: nextLine moves to the next line and the other functions
+ * consume tokens from the current line only.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef TEXTSCAN_H
+#define TEXTSCAN_H
+
+#include "utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief A run of bytes inside the mapped file.
+     */
+    typedef struct {
+        const char* start;
+        size_t length;
+    } TextToken;
+
+    /**
+     * @brief State of a scanner over one mapped file.
+     */
+    typedef struct {
+        const char* path;
+        void* map;
+        size_t size;
+        const char* next;       // start of the next line
+        const char* end;        // end of the file
+        const char* lineStart;  // start of the current line
+        const char* lineEnd;    // end of the current line, line terminator excluded
+        const char* cursor;     // position inside the current line
+        int line;               // number of the current line, starting at 1
+        int errors;             // number of errors reported
+    } TextScanner;
+
+    /**
+     * @brief Maps a file and prepares a scanner over it.
+     *
+     * @param scanner The scanner.
+     * @param path Path of the file.
+     * @return 1 on success, 0 if the file does not exist or cannot be mapped.
+     */
+    int openTextScanner(TextScanner* scanner, const char* path);
+
+    /**
+     * @brief Unmaps the file of a scanner.
+     *
+     * @param scanner The scanner.
+     * @return void - This function does not return a value.
+     */
+    void closeTextScanner(TextScanner* scanner);
+
+    /**
+     * @brief Moves to the next line of the file.
+     *
+     * @param scanner The scanner.
+     * @param line Receives the whole line, without its terminator. May be NULL.
+     * @return 1 if there was another line, 0 at the end of the file.
+     */
+    int nextLine(TextScanner* scanner, TextToken* line);
+
+    /**
+     * @brief Checks whether the current line has been fully consumed.
+     *
+     * @param scanner The scanner.
+     * @return 1 at the end of the line, 0 otherwise.
+     */
+    int atLineEnd(const TextScanner* scanner);
+
+    /**
+     * @brief Consumes a literal if the current line continues with it.
+     *
+     * @param scanner The scanner.
+     * @param literal The expected text.
+     * @return 1 if the literal was consumed, 0 otherwise.
+     */
+    int scanLiteral(TextScanner* scanner, const char* literal);
+
+    /**
+     * @brief Consumes the text up to a delimiter, or up to the end of the line.
+     *
+     * The delimiter itself is consumed but not included in the token.
+     *
+     * @param scanner The scanner.
+     * @param delimiter The delimiter.
+     * @param token Receives the text.
+     * @return 1 if the delimiter was found, 0 if the end of the line was reached first.
+     */
+    int scanUntil(TextScanner* scanner, char delimiter, TextToken* token);
+
+    /**
+     * @brief Skips spaces and tabs, then consumes a run of other characters.
+     *
+     * @param scanner The scanner.
+     * @param token Receives the word.
+     * @return 1 if a word was found, 0 at the end of the line.
+     */
+    int scanWord(TextScanner* scanner, TextToken* token);
+
+    /**
+     * @brief Consumes the rest of the current line.
+     *
+     * @param scanner The scanner.
+     * @param token Receives the text, with trailing spaces removed.
+     * @return void - This function does not return a value.
+     */
+    void scanRest(TextScanner* scanner, TextToken* token);
+
+    /**
+     * @brief Converts a token holding a whole decimal integer.
+     *
+     * @param token The token.
+     * @param value Receives the value.
+     * @return 1 on success, 0 if the token is not an integer or does not fit in an int.
+     */
+    int tokenToInt(TextToken token, int* value);
+
+    /**
+     * @brief Converts a token holding a whole decimal number, such as "4" or "-3.75".
+     *
+     * @param token The token.
+     * @param value Receives the value.
+     * @return 1 on success, 0 if the token is not a number.
+     */
+    int tokenToFloat(TextToken token, float* value);
+
+    /**
+     * @brief Compares a token with a string.
+     *
+     * @param token The token.
+     * @param text The string.
+     * @return 1 if they are equal, 0 otherwise.
+     */
+    int tokenEquals(TextToken token, const char* text);
+
+    /**
+     * @brief Commits a token to a NUL-terminated buffer, truncating it if needed.
+     *
+     * @param dest The buffer.
+     * @param size The size of the buffer.
+     * @param token The token.
+     * @return void - This function does not return a value.
+     */
+    void copyToken(char* dest, size_t size, TextToken token);
+
+    /**
+     * @brief Reports malformed input at a position of the current line.
+     *
+     * The message is printed as "path:line:column: message".
+     *
+     * @param scanner The scanner.
+     * @param at The position of the problem, inside the current line.
+     * @param message Description of the problem.
+     * @return void - This function does not return a value.
+     */
+    void reportScanError(TextScanner* scanner, const char* at, const char* message);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEXTSCAN_H */
@@ -0,0 +1,245 @@
+/**
+ * @file trigram.c
+ * @brief source file for the trigram index used to search companies by name and locality.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ *
+
+ */
+#include "trigram.h"
+#include "companytable.h"
+#include "textcolumn.h"
+
+/**
+ * @brief The trigram indexes over the names and the localities of the companies.
+ */
+static TrigramIndex nameIndex;
+static TrigramIndex localityIndex;
+
+/**
+ * @brief The same texts packed in columns, scanned for terms too short to have a trigram.
+ */
+static TextColumn nameColumn;
+static TextColumn localityColumn;
+
+    static uint32_t trigramKey(const char *text) {
+        return ((uint32_t) (unsigned char) text[0] << 16 | (uint32_t) (unsigned char) text[1] << 8 |
+                (uint32_t) (unsigned char) text[2]) + 1;
+    }
+
+    static unsigned int trigramHash(uint32_t key, int capacity) {
+        return ((key * 2654435761u) >> 8) & (capacity - 1);
+    }
+
+    static PostingList *findPostings(const TrigramIndex *index, uint32_t key) {
+        if (index->capacity == 0) {
+            return NULL;
+        }
+
+        unsigned int i = trigramHash(key, index->capacity);
+        while (index->keys[i] != 0) {
+            if (index->keys[i] == key) {
+                return &index->postings[i];
+            }
+            i = (i + 1) & (index->capacity - 1);
+        }
+        return NULL;
+    }
+
+    static int growTrigramIndex(TrigramIndex *index) {
+        int capacity = index->capacity > 0 ? index->capacity * 2 : 1024;
+        uint32_t *keys = calloc(capacity, sizeof(uint32_t));
+        PostingList *postings = calloc(capacity, sizeof(PostingList));
+
+        if (keys == NULL || postings == NULL) {
+            printf("Memory allocation error.\n");
+            free(keys);
+            free(postings);
+            return 0;
+        }
+
+        for (int i = 0; i < index->capacity; i++) {
+            if (index->keys[i] != 0) {
+                unsigned int j = trigramHash(index->keys[i], capacity);
+                while (keys[j] != 0) {
+                    j = (j + 1) & (capacity - 1);
+                }
+                keys[j] = index->keys[i];
+                postings[j] = index->postings[i];
+            }
+        }
+
+        free(index->keys);
+        free(index->postings);
+        index->keys = keys;
+        index->postings = postings;
+        index->capacity = capacity;
+        return 1;
+    }
+
+    static PostingList *getPostings(TrigramIndex *index, uint32_t key) {
+        PostingList *postings = findPostings(index, key);
+
+        if (postings != NULL) {
+            return postings;
+        }
+        if ((index->count + 1) * 10 > index->capacity * 7 && !growTrigramIndex(index)) {
+            return NULL;
+        }
+
+        unsigned int i = trigramHash(key, index->capacity);
+        while (index->keys[i] != 0) {
+            i = (i + 1) & (index->capacity - 1);
+        }
+        index->keys[i] = key;
+        index->count++;
+        return &index->postings[i];
+    }
+
+    static void addText(TrigramIndex *index, const char *text, int slot) {
+        size_t length = strlen(text);
+
+        for (size_t i = 0; i + 3 <= length; i++) {
+            PostingList *postings = getPostings(index, trigramKey(text + i));
+            if (postings != NULL) {
+                addPosting(postings, slot);
+            }
+        }
+    }
+
+    static void removeText(TrigramIndex *index, const char *text, int slot) {
+        size_t length = strlen(text);
+
+        for (size_t i = 0; i + 3 <= length; i++) {
+            PostingList *postings = findPostings(index, trigramKey(text + i));
+            if (postings != NULL) {
+                removePosting(postings, slot);
+            }
+        }
+    }
+
+    static void freeTrigramIndex(TrigramIndex *index) {
+        for (int i = 0; i < index->capacity; i++) {
+            freePostings(&index->postings[i]);
+        }
+        free(index->keys);
+        free(index->postings);
+        memset(index, 0, sizeof(TrigramIndex));
+    }
+
+    /*
+     * Intersects the posting lists of every trigram of the term.
+     * Returns the number of candidates left in the array, or -1 on failure.
+     */
+    static int intersectTrigrams(TrigramIndex *index, const char *term, size_t length, int **candidates) {
+        size_t numTrigrams = length - 2;
+        PostingList **lists = malloc(numTrigrams * sizeof(PostingList *));
+
+        *candidates = NULL;
+        if (lists == NULL) {
+            printf("Memory allocation error.\n");
+            return -1;
+        }
+
+        for (size_t i = 0; i < numTrigrams; i++) {
+            lists[i] = findPostings(index, trigramKey(term + i));
+            if (lists[i] == NULL || lists[i]->count == 0) {
+                free(lists);
+                return 0;
+            }
+        }
+
+        int count = intersectPostings(lists, numTrigrams, candidates);
+        free(lists);
+        return count;
+    }
+
+    static const char *companyText(const Company *company, SearchCriterion criterion) {
+        return criterion == SEARCH_NAME ? company->nameKey : company->localityKey;
+    }
+
+    void buildTrigramIndexes(const CompanyTable *companies) {
+        freeTrigramIndexes();
+
+        for (int i = 0; i < companies->count; i++) {
+            indexCompanyText(companyAt(companies, i));
+        }
+    }
+
+    void indexCompanyText(const Company *company) {
+        addText(&nameIndex, company->nameKey, company->tableSlot);
+        addText(&localityIndex, company->localityKey, company->tableSlot);
+        addColumnText(&nameColumn, company->tableSlot, company->nameKey);
+        addColumnText(&localityColumn, company->tableSlot, company->localityKey);
+    }
+
+    void unindexCompanyText(const Company *company) {
+        removeText(&nameIndex, company->nameKey, company->tableSlot);
+        removeText(&localityIndex, company->localityKey, company->tableSlot);
+        removeColumnText(&nameColumn, company->tableSlot);
+        removeColumnText(&localityColumn, company->tableSlot);
+    }
+
+    int searchCompanyText(const CompanyTable *companies, SearchCriterion criterion, const char *term, Company ***results) {
+        TrigramIndex *index = criterion == SEARCH_NAME ? &nameIndex : &localityIndex;
+        TextColumn *column = criterion == SEARCH_NAME ? &nameColumn : &localityColumn;
+        char key[100];
+        int found = 0;
+
+        // The index holds the folded keys, so the term is folded the same way.
+        foldText(key, sizeof(key), term);
+        size_t length = strlen(key);
+
+        *results = NULL;
+
+        // Terms too short to have a trigram are looked for in the whole column.
+        int *candidates;
+        int numCandidates = length < 3 ? scanTextColumn(column, key, &candidates) :
+                intersectTrigrams(index, key, length, &candidates);
+
+        if (numCandidates <= 0) {
+            return numCandidates;
+        }
+
+        *results = malloc(numCandidates * sizeof(Company *));
+        if (*results == NULL) {
+            printf("Memory allocation error.\n");
+            free(candidates);
+            return -1;
+        }
+
+        for (int i = 0; i < numCandidates; i++) {
+            Company *company = companyBySlot(companies, candidates[i]);
+            if (company != NULL && strstr(companyText(company, criterion), key) != NULL) {
+                (*results)[found++] = company;
+            }
+        }
+
+        free(candidates);
+        return found;
+    }
+
+    int estimateCompanyText(SearchCriterion criterion, const char *term) {
+        TrigramIndex *index = criterion == SEARCH_NAME ? &nameIndex : &localityIndex;
+        char key[100];
+        int estimate = -1;
+
+        foldText(key, sizeof(key), term);
+        for (size_t i = 0; i + 3 <= strlen(key); i++) {
+            PostingList *postings = findPostings(index, trigramKey(key + i));
+            int count = postings != NULL ? postings->count : 0;
+
+            if (estimate < 0 || count < estimate) {
+                estimate = count;
+            }
+        }
+        return estimate;
+    }
+
+    void freeTrigramIndexes() {
+        freeTrigramIndex(&nameIndex);
+        freeTrigramIndex(&localityIndex);
+        freeTextColumn(&nameColumn);
+        freeTextColumn(&localityColumn);
+    }
@@ -0,0 +1,103 @@
+/**
+ * @file trigram.h
+ * @brief Header file for the trigram index used to search companies by name and locality.
+ *
+ * The names and localities are indexed through their folded keys (see foldText), and search terms
+ * are folded the same way, so searches ignore case and accents at no extra cost.
+ *
+ * Every run of three consecutive bytes of a name or locality is a trigram. The index maps each
+ * trigram to the sorted list of the table slots of the companies whose text contains it. A
+ * search term of three or more bytes can only occur in a text that contains all of its trigrams,
+ * so the candidates are the intersection of those lists; each candidate is then checked with
+ * strstr, which gives exactly the results of a full strstr scan. Shorter terms are looked for
+ * in packed columns of the same texts (see textcolumn.h).
+ *
+ * The index is built once the catalog is loaded and is updated whenever a company is created,
+ * edited or removed.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 18-10-2026
+ */
+
+#ifndef TRIGRAM_H
+#define TRIGRAM_H
+
+#include <stdint.h>
+#include "utilities.h"
+#include "postings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Open-addressing hash from trigram to posting list.
+     */
+    typedef struct {
+        uint32_t* keys;  // trigram + 1, 0 for an empty entry
+        PostingList* postings;
+        int capacity;    // a power of two
+        int count;
+    } TrigramIndex;
+
+    /**
+     * @brief Builds the name and locality indexes from every company of the table.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void buildTrigramIndexes(const CompanyTable* companies);
+
+    /**
+     * @brief Adds the name and locality of a company to the indexes.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void indexCompanyText(const Company* company);
+
+    /**
+     * @brief Removes the name and locality of a company from the indexes.
+     *
+     * Must be called before the name or locality is changed, or before the company is removed.
+     *
+     * @param company The company.
+     * @return void - This function does not return a value.
+     */
+    void unindexCompanyText(const Company* company);
+
+    /**
+     * @brief Finds the companies whose name or locality contains a term, ignoring case and accents.
+     *
+     * @param companies The company table.
+     * @param criterion SEARCH_NAME or SEARCH_LOCALITY.
+     * @param term The search term.
+     * @param results Receives an array with the matching companies, to be freed by the caller.
+     * @return The number of matching companies, or -1 on failure.
+     */
+    int searchCompanyText(const CompanyTable* companies, SearchCriterion criterion, const char* term, Company*** results);
+
+    /**
+     * @brief Estimates the number of companies whose name or locality contains a term.
+     *
+     * The estimate is the length of the shortest posting list among the trigrams of the term,
+     * an upper bound of the number of matches.
+     *
+     * @param criterion SEARCH_NAME or SEARCH_LOCALITY.
+     * @param term The search term.
+     * @return The estimate, or -1 if the term is too short to use the index.
+     */
+    int estimateCompanyText(SearchCriterion criterion, const char* term);
+
+    /**
+     * @brief Frees the memory of the indexes.
+     *
+     * @return void - This function does not return a value.
+     */
+    void freeTrigramIndexes();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRIGRAM_H */
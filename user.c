@@ -1,165 +1,415 @@
-/**
- * @file user.c
- * @brief source file for user-related functionalities in the Company Management System.
- *
- * @author Vitor and Diogo (Group 16)
- * @date 01-01-2024
- *
-
- */
-#include "utilities.h"
-#include "adm.h"
-#include "user.h"
-
-void searchCompanies(Company companies[], int numCompanies) {
-       char searchTerm[100];
-        int criteria;
-
-        printf("Choose the search criterion:\n");
-        printf("1. Name\n");
-        printf("2. Category\n");
-        printf("3. Locality\n");
-        printf("Enter the criterion number: ");
-        scanf("%d", &criteria);
-
-        printf("Enter the search term: ");
-        scanf("%s", searchTerm);
-
-        int resultFound = 0; 
-
-
-        switch (criteria) {
-            case 1:
-                // Search by name
-                for (int i = 0; i < numCompanies; i++) {
-                    if (strstr(companies[i].name, searchTerm) != NULL) {
-                        printf("Name: %s\nCategory: %s\nBusiness Sector: %s\nLocality: %s\nPostal Code: %s\n\n",
-                                companies[i].name, companies[i].category, companies[i].businessSector,
-                                companies[i].locality, companies[i].postalCode);
-                        resultFound = 1;
-                    }
-                }
-                break;
-            case 2:
-                // Search by category
-                for (int i = 0; i < numCompanies; i++) {
-                    if (strstr(companies[i].category, searchTerm) != NULL) {
-                        printf("Name: %s\nCategory: %s\nBusiness Sector: %s\nLocality: %s\nPostal Code: %s\n\n",
-                                companies[i].name, companies[i].category, companies[i].businessSector,
-                                companies[i].locality, companies[i].postalCode);
-                        resultFound = 1;
-                    }
-
-                printf("NIF: %-5d\n", companies[i].nif);
-                printf("Name: %-15s\n", companies[i].name);
-                printf("Category: %-15s\n", companies[i].category);
-                printf("Business Sector: %-20s\n", companies[i].businessSector);
-                printf("Street: %-15s\n", companies[i].street);
-                printf("Locality: %-15s\n", companies[i].locality);
-                printf("Postal Code: %-10s\n", companies[i].postalCode);
-                printf("Active: %-10s\n", companies[i].active ? "Yes" : "No");
-                }
-                break;
-            case 3:
-                // Search by locality
-                for (int i = 0; i < numCompanies; i++) {
-                    if (strstr(companies[i].locality, searchTerm) != NULL) {
-                        printf("Name: %s\nCategory: %s\nBusiness Sector: %s\nLocality: %s\nPostal Code: %s\n\n",
-                                companies[i].name, companies[i].category, companies[i].businessSector,
-                                companies[i].locality, companies[i].postalCode);
-                        resultFound = 1;
-                    }
-                }
-                break;
-            default:
-                printf("Invalid search criterion.\n");
-        }
-
-        if (!resultFound) {
-            printf("No results found for the provided search criterion.\n");
-        }
-    }
-
-    void rateCompany(Company companies[], int numCompanies) {
-        printf("Companies available for rating:\n");
-
-        for (int i = 0; i < numCompanies; i++) {
-            printf("%d. %s\n", i + 1, companies[i].name);
-        }
-
-        int choice;
-        printf("Choose the company to rate: ");
-        scanf("%d", &choice);
-
-        if (choice >= 1 && choice <= numCompanies) {
-            int index = choice - 1;
-
-            float rating;
-            printf("Enter the rating (from 1 to 5) for %s: ", companies[index].name);
-            scanf("%f", &rating);
-
-            if (rating >= 1 && rating <= 5) {
-                // Add the rating to the ratings array
-                companies[index].ratings[companies[index].numRatings++] = rating;
-
-                // Update the average rating
-                float sum = 0;
-                for (int i = 0; i < companies[index].numRatings; i++) {
-                    sum += companies[index].ratings[i];
-                }
-                companies[index].averageRating = sum / companies[index].numRatings;
-
-                printf("Company %s rated successfully!\n", companies[index].name);
-
-                saveRatingsToFile(companies, numCompanies);
-            } else {
-                printf("Invalid rating. Please try again.\n");
-            }
-        } else {
-            printf("Invalid choice. Please try again.\n");
-        }
-    }
-
-void commentCompany(Comment comments[], int *numComments){
-
-        int numCompanies = loadCompanyCount();
-        loadCompaniesFromFile(companies, &numCompanies);
-        int choice;
-        printf("Companies available for commenting:\n");
-
-        for (int i = 0; i < numCompanies; i++) {
-            printf("%d. %s\n", i + 1, companies[i].name);
-        }
-
-        printf("Choose the company to comment on: ");
-        scanf("%d", &choice);
-
-       if (choice >= 1 && choice <= numCompanies) {
-            int index = choice - 1;
-
-            if (companies[index].numComments < MAX_COMMENTS) {
-
-                printf("Enter your name: ");
-                scanf("%s", companies[index].comments[companies[index].numComments].username);
-
-                printf("Enter the comment title: ");
-                scanf("%s", companies[index].comments[companies[index].numComments].title);
-
-                printf("Enter the comment text: ");
-                getchar();
-                fgets(companies[index].comments[companies[index].numComments].text,
-                      sizeof(companies[index].comments[0].text), stdin);
-
-                companies[index].numComments++;
-
-                printf("Comment added successfully!\n");
-
-
-                saveCommentsToFile(companies, numCompanies);
-            } else {
-                printf("Maximum comment limit reached for this company.\n");
-            }
-        } else {
-            printf("Invalid choice. Please try again.\n");
-        }
-    }
+/**
+ * @file user.c
+ * @brief source file for user-related functionalities in the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 01-01-2024
+ *
+
+ */
+#include "utilities.h"
+#include "adm.h"
+#include "user.h"
+#include "journal.h"
+#include "commentlog.h"
+#include "companytable.h"
+#include "trigram.h"
+#include "symbols.h"
+#include "facet.h"
+#include "leaderboard.h"
+#include "commentsearch.h"
+#include "fuzzy.h"
+#include "postalindex.h"
+#include "autocomplete.h"
+#include "query.h"
+#include "resultcursor.h"
+
+    /*
+     * Prints the comments matching a query, best first, with the company they were made on.
+     */
+    static int printCommentMatches(const CompanyTable* companies, const char* query) {
+        CommentMatch matches[10];
+        int numMatches = searchComments(query, 10, matches);
+        int numbers[10];
+        int nifs[10];
+        Comment comments[10];
+
+        // The matched comments are read together, each at its offset in the log.
+        for (int i = 0; i < numMatches; i++) {
+            numbers[i] = matches[i].comment;
+        }
+        if (numMatches > 0) {
+            loadCommentsByNumber(numbers, numMatches, nifs, comments);
+        }
+
+        for (int i = 0; i < numMatches; i++) {
+            if (nifs[i] < 0) {
+                continue;
+            }
+
+            Company* company = findCompanyByNif(companies, nifs[i]);
+            printf("Company: %s\nScore: %.2f\nUsername: %s\nTitle: %s\nText: %s\n\n",
+                    company != NULL ? company->name : "(removed)", matches[i].score,
+                    comments[i].username, comments[i].title, comments[i].text);
+        }
+        return numMatches > 0;
+    }
+
+    void searchCompanyComments(CompanyTable* companies) {
+        char words[100];
+
+        printf("Enter the words to search for: ");
+        scanf(" %99[^\n]", words);
+
+        if (!printCommentMatches(companies, words)) {
+            printf("No comments found.\n");
+        }
+    }
+
+    static void printSearchResult(const Company* company, int number) {
+        printf("%d. Name: %s\nCategory: %s\nBusiness Sector: %s\nLocality: %s\nPostal Code: %s\n\n",
+                number, company->name, getCategoryName(company->category),
+                symbolName(&sectorSymbols, company->sectorId),
+                symbolName(&localitySymbols, company->localityId), company->postalCode);
+    }
+
+    /*
+     * Shows the results a page at a time, sorting only the pages shown.
+     */
+    static void printSearchResults(Company** results, int numResults, ResultOrder order) {
+        if (numResults <= 0) {
+            return;
+        }
+
+        ResultCursor* cursor = openResultCursor(results, numResults, order, RESULT_PAGE_SIZE);
+        if (cursor != NULL) {
+            browseResults(cursor, printSearchResult);
+            closeResultCursor(cursor);
+        }
+    }
+
+    /*
+     * Reads the value of one facet for a combined search and adds it to the filters.
+     * Returns 0 if the value is not used by any company, so nothing can match.
+     */
+    static int readFacetFilter(const char* prompt, FacetField field, FacetFilter filters[], int* numFilters) {
+        char value[100];
+
+        printf("%s (* for any): ", prompt);
+        scanf(" %99[^\n]", value);
+
+        if (strcmp(value, "*") == 0) {
+            return 1;
+        }
+
+        FacetFilter filter = {field, -1};
+        if (field == FACET_CATEGORY) {
+            filter.value = parseCategory(value);
+        } else {
+            filter.value = findSymbol(field == FACET_SECTOR ? &sectorSymbols : &localitySymbols, value);
+        }
+
+        filters[(*numFilters)++] = filter;
+        return filter.value >= (field == FACET_CATEGORY ? MICRO : 0);
+    }
+
+void searchCompanies(CompanyTable* companies) {
+       char searchTerm[100];
+        char queryText[200];
+        int criteria;
+
+        printf("Choose the search criterion:\n");
+        printf("1. Name\n");
+        printf("2. Category\n");
+        printf("3. Locality\n");
+        printf("4. Category, Business Sector and Locality\n");
+        printf("5. Comments\n");
+        printf("6. Name, allowing typos\n");
+        printf("7. Postal Code region or range (e.g. 4700 or 4700-000:4799-999)\n");
+        printf("8. Name starting with (best rated first)\n");
+        printf("9. Query (e.g. sector=Vendas and rating>=4 or name~lda order rating limit 10)\n");
+        printf("Enter the criterion number: ");
+        scanf("%d", &criteria);
+
+        if (criteria == SEARCH_NAME || criteria == SEARCH_CATEGORY || criteria == SEARCH_LOCALITY ||
+                criteria == SEARCH_NAME_FUZZY || criteria == SEARCH_POSTAL_CODE) {
+            printf("Enter the search term: ");
+            scanf("%99s", searchTerm);
+        } else if (criteria == SEARCH_NAME_PREFIX) {
+            printf("Enter the beginning of the name: ");
+            scanf(" %99[^\n]", searchTerm);
+        } else if (criteria == SEARCH_QUERY) {
+            printf("Enter the query: ");
+            scanf(" %199[^\n]", queryText);
+        } else if (criteria == SEARCH_COMMENTS) {
+            printf("Enter the words to search for: ");
+            scanf(" %99[^\n]", searchTerm);
+        }
+
+        int resultFound = 0; 
+        Company** results;
+        int numResults;
+        FacetFilter filters[3];
+        int numFilters = 0;
+        int canMatch = 1;
+        FuzzyMatch* matches;
+        int low, high;
+        Company* completions[MAX_COMPLETIONS];
+        Query query;
+        QueryPlan plan;
+
+
+        switch (criteria) {
+            case SEARCH_NAME:
+                // Search by name, through the trigram index
+                numResults = searchCompanyText(companies, SEARCH_NAME, searchTerm, &results);
+                printSearchResults(results, numResults, ORDER_NAME);
+                resultFound = numResults > 0;
+                free(results);
+                break;
+            case SEARCH_CATEGORY:
+                // Search by category: match the term against the category names,
+                // then print the posting list of each matching category
+                for (Categoria category = MICRO; category <= BIG; category++) {
+                    if (strstr(getCategoryName(category), searchTerm) == NULL) {
+                        continue;
+                    }
+
+                    FacetFilter filter = {FACET_CATEGORY, category};
+                    numResults = searchCompanyFacets(companies, &filter, 1, NULL, &results);
+                    printSearchResults(results, numResults, ORDER_NAME);
+                    resultFound = resultFound || numResults > 0;
+                    free(results);
+                }
+                break;
+            case SEARCH_LOCALITY:
+                // Search by locality, through the trigram index
+                numResults = searchCompanyText(companies, SEARCH_LOCALITY, searchTerm, &results);
+                printSearchResults(results, numResults, ORDER_NAME);
+                resultFound = numResults > 0;
+                free(results);
+                break;
+            case SEARCH_FACETS:
+                // Search by exact values, intersecting the posting lists of the facets
+                canMatch = readFacetFilter("Category", FACET_CATEGORY, filters, &numFilters) && canMatch;
+                canMatch = readFacetFilter("Business Sector", FACET_SECTOR, filters, &numFilters) && canMatch;
+                canMatch = readFacetFilter("Locality", FACET_LOCALITY, filters, &numFilters) && canMatch;
+
+                if (numFilters == 0) {
+                    printf("Enter at least one value.\n");
+                    return;
+                }
+
+                char onlyActive;
+                printf("Only active companies (y/n): ");
+                scanf(" %c", &onlyActive);
+
+                if (canMatch) {
+                    numResults = searchCompanyFacets(companies, filters, numFilters,
+                            onlyActive == 'y' || onlyActive == 'Y' ? &companies->activeSlots : NULL, &results);
+                    printSearchResults(results, numResults, ORDER_NAME);
+                    resultFound = numResults > 0;
+                    free(results);
+                }
+                break;
+            case SEARCH_COMMENTS:
+                // Search the comment text, ranked through the comment index
+                resultFound = printCommentMatches(companies, searchTerm);
+                break;
+            case SEARCH_NAME_FUZZY:
+                // Search by name, allowing one typo for every four characters of the term;
+                // the matches come fewest typos first and are shown a page at a time
+                numResults = searchCompanyNamesFuzzy(companies, searchTerm, fuzzyMaxDistance(searchTerm), &matches);
+                if (numResults < 0) {
+                    return;
+                }
+                results = malloc((numResults + 1) * sizeof(Company*));
+                if (results == NULL) {
+                    printf("Memory allocation error.\n");
+                    free(matches);
+                    return;
+                }
+                for (int i = 0; i < numResults; i++) {
+                    results[i] = matches[i].company;
+                }
+                printSearchResults(results, numResults, ORDER_NONE);
+                resultFound = numResults > 0;
+                free(results);
+                free(matches);
+                break;
+            case SEARCH_POSTAL_CODE:
+                // Search by postal code, through the sorted postal code index
+                if (!parsePostalCodeRange(searchTerm, &low, &high)) {
+                    printf("Invalid postal code region or range.\n");
+                    return;
+                }
+                numResults = searchCompanyPostalCodes(companies, low, high, &results);
+                printSearchResults(results, numResults, ORDER_NAME);
+                resultFound = numResults > 0;
+                free(results);
+                break;
+            case SEARCH_NAME_PREFIX:
+                // Complete the name through the sorted name index, best rated first
+                numResults = completeCompanyName(searchTerm, MAX_COMPLETIONS, completions);
+                for (int i = 0; i < numResults; i++) {
+                    printf("%d. %s (%.2f, %d ratings)\n", i + 1, completions[i]->name,
+                            calculateAverageRating(&completions[i]->ratings), completions[i]->ratings.count);
+                }
+                resultFound = numResults > 0;
+                break;
+            case SEARCH_QUERY:
+                // Run the query through the indexes chosen by the planner, and show the plan
+                if (!parseQuery(queryText, &query)) {
+                    return;
+                }
+                numResults = runQuery(companies, &query, &results, &plan);
+                printSearchResults(results, numResults, query.order);
+                if (numResults >= 0) {
+                    printQueryPlan(&query, &plan);
+                }
+                resultFound = numResults > 0;
+                free(results);
+                break;
+            default:
+                printf("Invalid search criterion.\n");
+        }
+
+        if (!resultFound) {
+            printf("No results found for the provided search criterion.\n");
+        }
+    }
+
+    void rateCompany(CompanyTable* companies) {
+        printf("Companies available for rating:\n");
+
+        for (int i = 0; i < companies->count; i++) {
+            printf("%d. %s\n", i + 1, companyAt(companies, i)->name);
+        }
+
+        int choice;
+        printf("Choose the company to rate: ");
+        scanf("%d", &choice);
+
+        if (choice >= 1 && choice <= companies->count) {
+            Company* company = companyAt(companies, choice - 1);
+
+            float rating;
+            printf("Enter the rating (from 1 to 5) for %s: ", company->name);
+            scanf("%f", &rating);
+
+            if (rating >= 1 && rating <= 5) {
+                // Update the running aggregate and the leaderboards; the rating itself goes to the journal
+                unrankCompany(company);
+                addRating(&company->ratings, rating);
+                rankCompany(company);
+                updateCompanyNameRating(company);
+
+                printf("Company %s rated successfully!\n", company->name);
+
+                appendRatingToJournal(company->nif, rating);
+            } else {
+                printf("Invalid rating. Please try again.\n");
+            }
+        } else {
+            printf("Invalid choice. Please try again.\n");
+        }
+    }
+
+void commentCompany(Comment comments[], int *numComments){
+
+        int choice;
+        printf("Companies available for commenting:\n");
+
+        for (int i = 0; i < companies.count; i++) {
+            printf("%d. %s\n", i + 1, companyAt(&companies, i)->name);
+        }
+
+        printf("Choose the company to comment on: ");
+        scanf("%d", &choice);
+
+       if (choice >= 1 && choice <= companies.count) {
+            Company* company = companyAt(&companies, choice - 1);
+
+            if (company->numComments < MAX_COMMENTS) {
+                Comment comment;
+
+                printf("Enter your name: ");
+                scanf("%49s", comment.username);
+
+                printf("Enter the comment title: ");
+                scanf("%99s", comment.title);
+
+                printf("Enter the comment text: ");
+                getchar();
+                if (fgets(comment.text, sizeof(comment.text), stdin) == NULL) {
+                    comment.text[0] = '\0';
+                }
+                comment.text[strcspn(comment.text, "\n")] = '\0';
+
+                company->numComments++;
+
+                if (appendCommentToLog(company->nif, &comment)) {
+                    indexNewComments();
+                }
+                printf("Comment added successfully!\n");
+            } else {
+                printf("Maximum comment limit reached for this company.\n");
+            }
+        } else {
+            printf("Invalid choice. Please try again.\n");
+        }
+    }
+
+    void viewBestRatedCompanies(CompanyTable* companies) {
+        char sectorName[100];
+        int sectorId = -1;
+        int maxResults;
+
+        printf("Business Sector (* for all): ");
+        scanf(" %99[^\n]", sectorName);
+
+        if (strcmp(sectorName, "*") != 0) {
+            sectorId = findSymbol(&sectorSymbols, sectorName);
+            if (sectorId < 0) {
+                printf("Business sector not found.\n");
+                return;
+            }
+        }
+
+        printf("Number of companies to show: ");
+        if (scanf("%d", &maxResults) != 1 || maxResults < 1) {
+            printf("Invalid number.\n");
+            return;
+        }
+
+        Company** results = malloc(maxResults * sizeof(Company*));
+        if (results == NULL) {
+            printf("Memory allocation error.\n");
+            return;
+        }
+
+        int numResults = getTopCompanies(sectorId, maxResults, results);
+        if (numResults == 0) {
+            printf("No rated companies found.\n");
+        }
+        for (int i = 0; i < numResults; i++) {
+            printf("%d. %s - Average Rating: %.2f (%d ratings)\n", i + 1, results[i]->name,
+                    calculateAverageRating(&results[i]->ratings), results[i]->ratings.count);
+        }
+        free(results);
+
+        int nif;
+        printf("Enter the NIF of a company to see its rank (0 to skip): ");
+        scanf("%d", &nif);
+
+        if (nif != 0) {
+            Company* company = findCompanyByNif(companies, nif);
+            int rank = company != NULL ? getCompanyRank(company, sectorId) : 0;
+
+            if (rank > 0) {
+                printf("%s is ranked %d.\n", company->name, rank);
+            } else {
+                printf("Company not found or not ranked.\n");
+            }
+        }
+    }
@@ -1,374 +1,369 @@
-/**
- * @file utilities.c
- * @brief file containing utility functions and data structures for the Company Management System.
- *
- * @author Vitor and Diogo (Group 16)
- * @date 05-01-2024
- *
-
- */
-#include "utilities.h"
-/**
- * @brief A structure representing a list of business sectors.
- */
-BusinessSectorList sectorList;
-
-/**
- * @brief The initial number of companies in the system.
- */
-int numCompanies = 0;
-
-/**
- * @brief The initial number of comments made on companies.
- */
-int numComments = 0;
-
-/**
- * @brief An array representing the companies in the system.
- */
-Company companies[MAX_COMPANIES];
-
-    const char* getCategoryName(Categoria category) {
-        static const char* categoryNames[] = {
-            [MICRO] = "MICRO",
-            [SMALL] = "SMALL",
-            [MEDIUM] = "MEDIUM",
-            [BIG] = "BIG",
-        };
-
-        if (category >= MICRO && category <= BIG) {
-            return categoryNames[category];
-        } else {
-            return "UNKNOWN";
-        }
-    }
-
-    void saveBusinessSectorsToFile(BusinessSector* businessSectors, int numBusinessSectors) {
-        FILE* file = fopen("business_sectors.txt", "w");
-
-        if (file == NULL) {
-            printf("Error opening file for writing.\n");
-            return;
-        }
-
-        for (int i = 0; i < numBusinessSectors; ++i) {
-            fprintf(file, "%s|%d\n", businessSectors[i].name, businessSectors[i].isActive);
-        }
-
-        fclose(file);
-    }
-
-    void loadBusinessSectorsFromFile(BusinessSector** businessSectors, int* numBusinessSectors) {
-
-            FILE *file = fopen("business_sectors.txt", "r");
-        if (file == NULL) {
-            file = fopen("business_sectors.txt", "w");
-            *numBusinessSectors = 0;
-            fclose(file);
-            return;
-        }
-
-        int maxBusinessSectors = 100;
-        *businessSectors = (BusinessSector*)malloc(maxBusinessSectors * sizeof(BusinessSector));
-
-        if (*businessSectors == NULL) {
-            printf("Memory allocation error.\n");
-            *numBusinessSectors = 0;
-            fclose(file);
-            return;
-        }
-
-        *numBusinessSectors = 0;
-
-        while (*numBusinessSectors < maxBusinessSectors && fscanf(file, " %99[^|]|%d", (*businessSectors)[*numBusinessSectors].name, &(*businessSectors)[*numBusinessSectors].isActive) == 2) {
-            (*numBusinessSectors)++;
-        }
-
-        fclose(file);
-    }
-
-    int isBusinessSectorInUse(const Company* companies, int numCompanies, const char* businessSector) {
-        for (int i = 0; i < numCompanies; i++) {
-            if (strcmp(companies[i].businessSector, businessSector) == 0) {
-                return 1; 
-            }
-        }
-        return 0; 
-    }
-
-    void freeBusinessSectorList(BusinessSectorList* sectorList) {
-        for (int i = 0; i < sectorList->numSectors; i++) {
-            free(sectorList->sectors[i]);
-        }
-        free(sectorList->sectors);
-    }
-
-    void shiftArray(Company* arr, size_t size, size_t index) {
-        if (index < size - 1) {
-            memmove(&arr[index], &arr[index + 1], (size - index - 1) * sizeof(Company));
-        }
-    }
-
-    float calculateAverageRating(float ratings[], int numRatings) {
-        if (numRatings == 0) {
-            return 0.0;
-        }
-
-        float sum = 0;
-        for (int i = 0; i < numRatings; i++) {
-            sum += ratings[i];
-        }
-
-        return sum / numRatings;
-    }
-
-    void saveCompaniesToFile(Company companies[], int numCompanies) {
-        FILE *file;
-        file = fopen("companies.txt", "a");
-
-        if (file == NULL) {
-            printf("Error opening file for writing.\n");
-            return;
-        }
-
-        for (int i = 0; i < numCompanies; i++) {
-            fprintf(file, "Company %d:\n", i + 1);
-            fprintf(file, "NIF: %d\n", companies[i].nif);
-            fprintf(file, "Name: %s\n", companies[i].name);
-            fprintf(file, "Category: %s\n", companies[i].category);
-            fprintf(file, "Business Sector: %s\n", companies[i].businessSector);
-            fprintf(file, "Street: %s\n", companies[i].street);
-            fprintf(file, "Locality: %s\n", companies[i].locality);
-            fprintf(file, "Postal Code: %s\n", companies[i].postalCode);
-            fprintf(file, "Active: %d\n", companies[i].active);
-
-            fprintf(file, "\n");
-        }
-
-        fclose(file);
-
-    }
-
-    void loadCompaniesFromFile(Company companies[], int *numCompanies) {
-        FILE *file = fopen("companies.txt", "r");
-        if (file == NULL) {
-
-            file = fopen("companies.bin", "wb");
-            fclose(file);
-            return;
-        }
-
-        while (fscanf(file, "Company %*d:\n") != EOF) {
-            int index = (*numCompanies)++;
-            fscanf(file, "NIF: %d\n", &companies[index].nif);
-            fscanf(file, "Name: %s\n", companies[index].name);
-            fscanf(file, "Category: %s\n", companies[index].category);
-            fscanf(file, "Business Sector: %s\n", companies[index].businessSector);
-            fscanf(file, "Street: %s\n", companies[index].street);
-            fscanf(file, "Locality: %s\n", companies[index].locality);
-            fscanf(file, "Postal Code: %s\n", companies[index].postalCode);
-            fscanf(file, "Active: %d\n", &companies[index].active);
-
-
-            for (int i = 0; i < MAX_COMMENTS; i++) {
-                fscanf(file, "Username: %s\n", companies[index].comments[i].username);
-                fscanf(file, "Title: %s\n", companies[index].comments[i].title);
-                fscanf(file, "Text: %s\n", companies[index].comments[i].text);
-            }
-
-            fscanf(file, "Ratings: ");
-            for (int i = 0; i < MAX_RATINGS; i++) {
-                fscanf(file, "%f ", &companies[index].ratings[i]);
-            }
-            fscanf(file, "\n\n");
-
-        }
-
-        fclose(file);
-
-    }
-    
-    int loadCompanyCount() {
-        FILE *file;
-        file = fopen("company_count.bin", "rb");
-
-        if (file == NULL) {
-            printf("");
-            return 0;
-        }
-
-        int numCompanies;
-        fscanf(file, "%d", &numCompanies);
-
-        fclose(file);
-        return numCompanies;
-    }
-
-    void saveCompanyCount(int numCompanies) {
-        FILE *file = fopen("company_count.bin", "wb");
-        if (file == NULL) {
-            perror("Error opening file for writing");
-            exit(EXIT_FAILURE);
-        }
-
-        fprintf(file, "%d\n", numCompanies);
-
-        fclose(file);
-    }
-    
-    int isValidPostalCode(const char *postalCode) {
-        int length = strlen(postalCode);
-
-
-        return (length == 8 && isdigit(postalCode[0]) && isdigit(postalCode[1]) &&
-            isdigit(postalCode[2]) && isdigit(postalCode[3]) && postalCode[4] == '-' &&
-            isdigit(postalCode[5]) && isdigit(postalCode[6]) && isdigit(postalCode[7]));
-    }
-
-   
-    
-    void saveNotRemovedCompaniesToFile(int numCompanies) {
-        FILE *file = fopen("companies.txt", "w");
-
-        if (file != NULL) {
-            for (int i = 0; i < numCompanies; i++) {
-                if (companies[i].active == 1) {
-                    fprintf(file, "Company %d:\n", i + 1);
-                    fprintf(file, "NIF: %d\n", companies[i].nif);
-                    fprintf(file, "Name: %s\n", companies[i].name);
-                    fprintf(file, "Category: %s\n", companies[i].category);
-                    fprintf(file, "Business Sector: %s\n", companies[i].businessSector);
-                    fprintf(file, "Street: %s\n", companies[i].street);
-                    fprintf(file, "Locality: %s\n", companies[i].locality);
-                    fprintf(file, "Postal Code: %s\n", companies[i].postalCode);
-                    fprintf(file, "Active: %d\n", companies[i].active);
-                }
-            }
-
-            fclose(file);
-        } else {
-            printf("Erro ao abrir o arquivo para salvar.\n");
-        }
-    }
-    
-    
-    int findIndexByNIF(int nif) {
-        for (int i = 0; i < MAX_COMPANIES; i++) {
-            if (companies[i].nif == nif && companies[i].active == 1) {
-                return i;
-            }
-        }
-        return -1;
-    }
-
-    int companyHasComments(int index) {
-        return companies[index].numComments > 0;
-    }
-
- void saveRatingsToFile(Company companies[], int numCompanies) {
-        FILE *file = fopen("ratings.txt", "w");
-
-        if (file == NULL) {
-            printf("Error opening file for writing.\n");
-            return;
-        }
-
-        for (int i = 0; i < numCompanies; i++) {
-            fprintf(file, "%s %f %d", companies[i].name, companies[i].averageRating, companies[i].numRatings);
-
-            for (int j = 0; j < companies[i].numRatings; j++) {
-                fprintf(file, " %f", companies[i].ratings[j]);
-            }
-
-            fprintf(file, "\n");
-        }
-
-        fclose(file);
-    }
-
-    void loadRatingsFromFile(Company companies[], int numCompanies) {
-        FILE *file = fopen("ratings.txt", "r");
-
-        if (file == NULL) {
-            printf("");
-            return;
-        }
-
-        for (int i = 0; i < numCompanies; i++) {
-            int numRatings;
-            fscanf(file, "%s %f %d", companies[i].name, &companies[i].averageRating, &numRatings);
-            companies[i].numRatings = numRatings;
-
-            for (int j = 0; j < numRatings; j++) {
-                fscanf(file, " %f", &companies[i].ratings[j]);
-            }
-        }
-
-        fclose(file);
-    }
-
-
-    void saveCommentsToFile(Company companies[], int numCompanies) {
-        FILE *file = fopen("comments.txt", "a");
-
-        if (file == NULL) {
-            printf("Error opening file for writing.\n");
-            return;
-        }
-
-        for (int i = 0; i < numCompanies; i++) {
-            for (int j = 0; j < companies[i].numComments; j++) {
-                fprintf(file, "Company: %s\n", companies[i].name);
-                fprintf(file, "Username: %s\n", companies[i].comments[j].username);
-                fprintf(file, "Title: %s\n", companies[i].comments[j].title);
-                fprintf(file, "Text: %s\n", companies[i].comments[j].text);
-                fprintf(file, "------------------------------\n");
-            }
-        }
-
-        fclose(file);
-        printf("Comments saved to file successfully!\n");
-    }
-
-
-    void loadCommentsFromFile(Company companies[], int *numCompanies) {
-        FILE *file = fopen("comments.txt", "r");
-
-        if (file == NULL) {
-            printf("");
-            return;
-        }
-
-        int i = -1;
-
-        while (!feof(file)) {
-            char buffer[1000]; 
-            if (fgets(buffer, sizeof(buffer), file) != NULL) {
-                if (strncmp(buffer, "Company:", 8) == 0) {
-
-                    i++;
-                    sscanf(buffer, "Company: %s", companies[i].name);
-                    companies[i].numComments = 0;
-                } else if (strncmp(buffer, "Username:", 9) == 0) {
-
-                    int currentCommentIndex = companies[i].numComments;
-                    sscanf(buffer, "Username: %s", companies[i].comments[currentCommentIndex].username);
-
-                    fgets(buffer, sizeof(buffer), file);
-                    sscanf(buffer, "Title: %s", companies[i].comments[currentCommentIndex].title);
-
-                    fgets(buffer, sizeof(buffer), file);
-                    sscanf(buffer, "Text: %[^\n]", companies[i].comments[currentCommentIndex].text);
-
-                    fgets(buffer, sizeof(buffer), file); 
-
-                    companies[i].numComments++; 
-                    
-                }
-            }
-        }
-
-        fclose(file);
-        *numCompanies = i + 1;
-        printf("Comments loaded from file successfully!\n");
-    }
+/**
+ * @file utilities.c
+ * @brief file containing utility functions and data structures for the Company Management System.
+ *
+ * @author Vitor and Diogo (Group 16)
+ * @date 05-01-2024
+ *
+
+ */
+#include "utilities.h"
+#include "store.h"
+#include "journal.h"
+#include "commentlog.h"
+#include "textscan.h"
+#include "companytable.h"
+#include "symbols.h"
+/**
+ * @brief The list of business sectors, loaded once at startup.
+ */
+BusinessSectorList sectorList;
+
+/**
+ * @brief The initial number of comments made on companies.
+ */
+int numComments = 0;
+
+/**
+ * @brief The table of the companies in the system.
+ */
+CompanyTable companies;
+
+    const char* getCategoryName(Categoria category) {
+        static const char* categoryNames[] = {
+            [MICRO] = "MICRO",
+            [SMALL] = "SMALL",
+            [MEDIUM] = "MEDIUM",
+            [BIG] = "BIG",
+        };
+
+        if (category >= MICRO && category <= BIG) {
+            return categoryNames[category];
+        } else {
+            return "UNKNOWN";
+        }
+    }
+
+    Categoria parseCategory(const char* name) {
+        for (Categoria category = MICRO; category <= BIG; category++) {
+            if (strcmp(getCategoryName(category), name) == 0) {
+                return category;
+            }
+        }
+        return 0;
+    }
+
+    void foldText(char* dest, size_t size, const char* text) {
+        // Base letters of U+00C0 to U+00FF; 0 keeps the character as it is.
+        static const char baseLetters[64] = {
+            'a', 'a', 'a', 'a', 'a', 'a', 'a', 'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+            'd', 'n', 'o', 'o', 'o', 'o', 'o', 0, 'o', 'u', 'u', 'u', 'u', 'y', 0, 's',
+            'a', 'a', 'a', 'a', 'a', 'a', 'a', 'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+            'd', 'n', 'o', 'o', 'o', 'o', 'o', 0, 'o', 'u', 'u', 'u', 'u', 'y', 0, 'y'
+        };
+        const unsigned char* p = (const unsigned char*) text;
+        size_t length = 0;
+
+        while (*p != '\0' && length + 1 < size) {
+            if (*p == 0xC3 && p[1] >= 0x80 && p[1] <= 0xBF && baseLetters[p[1] - 0x80] != 0) {
+                // UTF-8 encoding of U+00C0 to U+00FF
+                dest[length++] = baseLetters[p[1] - 0x80];
+                p += 2;
+            } else if (*p >= 0xC0 && (p[1] < 0x80 || p[1] > 0xBF) && baseLetters[*p - 0xC0] != 0) {
+                // Latin-1 byte, not followed by a UTF-8 continuation byte
+                dest[length++] = baseLetters[*p - 0xC0];
+                p++;
+            } else {
+                dest[length++] = *p >= 'A' && *p <= 'Z' ? *p - 'A' + 'a' : *p;
+                p++;
+            }
+        }
+        dest[length] = '\0';
+    }
+
+    static int reserveSectorPosition(BusinessSectorList* sectorList, int sectorId) {
+        if (sectorId < sectorList->positionCapacity) {
+            return 1;
+        }
+
+        int capacity = sectorList->positionCapacity > 0 ? sectorList->positionCapacity : INITIAL_BUFFER_SIZE;
+        while (capacity <= sectorId) {
+            capacity *= 2;
+        }
+
+        int* positions = realloc(sectorList->positions, capacity * sizeof(int));
+        if (positions == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        for (int i = sectorList->positionCapacity; i < capacity; i++) {
+            positions[i] = -1;
+        }
+
+        sectorList->positions = positions;
+        sectorList->positionCapacity = capacity;
+        return 1;
+    }
+
+    static int reserveSector(BusinessSectorList* sectorList) {
+        if (sectorList->numSectors < sectorList->capacity) {
+            return 1;
+        }
+
+        int capacity = sectorList->capacity > 0 ? sectorList->capacity * 2 : INITIAL_BUFFER_SIZE;
+        const char** sectors = realloc(sectorList->sectors, capacity * sizeof(char*));
+        if (sectors != NULL) {
+            sectorList->sectors = sectors;
+        }
+        int* activeStatus = realloc(sectorList->activeStatus, capacity * sizeof(int));
+        if (activeStatus != NULL) {
+            sectorList->activeStatus = activeStatus;
+        }
+        int* sectorIds = realloc(sectorList->sectorIds, capacity * sizeof(int));
+        if (sectorIds != NULL) {
+            sectorList->sectorIds = sectorIds;
+        }
+
+        if (sectors == NULL || activeStatus == NULL || sectorIds == NULL) {
+            printf("Memory allocation error.\n");
+            return 0;
+        }
+        sectorList->capacity = capacity;
+        return 1;
+    }
+
+    void saveBusinessSectorList(BusinessSectorList* sectorList) {
+        if (!sectorList->dirty) {
+            return;
+        }
+
+        FILE* file = fopen("business_sectors.txt", "w");
+
+        if (file == NULL) {
+            printf("Error opening file for writing.\n");
+            return;
+        }
+
+        for (int i = 0; i < sectorList->numSectors; ++i) {
+            fprintf(file, "%s|%d\n", sectorList->sectors[i], sectorList->activeStatus[i]);
+        }
+
+        fclose(file);
+        sectorList->dirty = 0;
+    }
+
+    void loadBusinessSectorList(BusinessSectorList* sectorList) {
+        TextScanner scanner;
+
+        if (!openTextScanner(&scanner, "business_sectors.txt")) {
+            FILE *file = fopen("business_sectors.txt", "w");
+            if (file != NULL) {
+                fclose(file);
+            }
+            return;
+        }
+
+        TextToken name;
+        TextToken status;
+        char text[100];
+
+        while (nextLine(&scanner, NULL)) {
+            if (atLineEnd(&scanner)) {
+                continue;
+            }
+
+            int active;
+            if (!scanUntil(&scanner, '|', &name)) {
+                reportScanError(&scanner, name.start, "expected \"name|status\"");
+                continue;
+            }
+            scanRest(&scanner, &status);
+            if (!tokenToInt(status, &active)) {
+                reportScanError(&scanner, status.start, "invalid status");
+                continue;
+            }
+
+            copyToken(text, sizeof(text), name);
+            if (findBusinessSector(sectorList, text) >= 0) {
+                reportScanError(&scanner, name.start, "duplicate business sector");
+                continue;
+            }
+            if (addBusinessSector(sectorList, text, active != 0) < 0) {
+                break;
+            }
+        }
+
+        closeTextScanner(&scanner);
+        sectorList->dirty = 0;
+    }
+
+    int addBusinessSector(BusinessSectorList* sectorList, const char* name, int active) {
+        if (findBusinessSector(sectorList, name) >= 0) {
+            return -1;
+        }
+
+        int sectorId = internSymbol(&sectorSymbols, name);
+        if (sectorId < 0 || !reserveSectorPosition(sectorList, sectorId) || !reserveSector(sectorList)) {
+            return -1;
+        }
+
+        int position = sectorList->numSectors++;
+        sectorList->sectors[position] = symbolName(&sectorSymbols, sectorId);
+        sectorList->activeStatus[position] = 0;
+        sectorList->sectorIds[position] = sectorId;
+        sectorList->positions[sectorId] = position;
+        setBusinessSectorActive(sectorList, position, active);
+        return position;
+    }
+
+    void setBusinessSectorActive(BusinessSectorList* sectorList, int position, int active) {
+        sectorList->activeStatus[position] = active ? 1 : 0;
+
+        if (active) {
+            bitmapAdd(&sectorList->activeSectors, position);
+        } else {
+            bitmapRemove(&sectorList->activeSectors, position);
+        }
+        sectorList->dirty = 1;
+    }
+
+    int findBusinessSector(const BusinessSectorList* sectorList, const char* name) {
+        int sectorId = findSymbol(&sectorSymbols, name);
+
+        if (sectorId < 0 || sectorId >= sectorList->positionCapacity) {
+            return -1;
+        }
+        return sectorList->positions[sectorId];
+    }
+
+    void removeBusinessSectorAt(BusinessSectorList* sectorList, int position) {
+        if (position < 0 || position >= sectorList->numSectors) {
+            return;
+        }
+
+        sectorList->positions[sectorList->sectorIds[position]] = -1;
+
+        for (int i = position; i < sectorList->numSectors - 1; ++i) {
+            sectorList->sectors[i] = sectorList->sectors[i + 1];
+            sectorList->activeStatus[i] = sectorList->activeStatus[i + 1];
+            sectorList->sectorIds[i] = sectorList->sectorIds[i + 1];
+            sectorList->positions[sectorList->sectorIds[i]] = i;
+        }
+
+        sectorList->numSectors--;
+
+        // The positions after the removed sector moved down by one
+        clearBitmap(&sectorList->activeSectors);
+        for (int i = 0; i < sectorList->numSectors; ++i) {
+            if (sectorList->activeStatus[i]) {
+                bitmapAdd(&sectorList->activeSectors, i);
+            }
+        }
+        sectorList->dirty = 1;
+    }
+
+    int isBusinessSectorInUse(const CompanyTable* companies, const char* businessSector) {
+        return countCompaniesInSector(companies, findSymbol(&sectorSymbols, businessSector)) > 0;
+    }
+
+    void freeBusinessSectorList(BusinessSectorList* sectorList) {
+        free(sectorList->sectors);
+        free(sectorList->activeStatus);
+        free(sectorList->sectorIds);
+        free(sectorList->positions);
+        freeBitmap(&sectorList->activeSectors);
+        memset(sectorList, 0, sizeof(BusinessSectorList));
+    }
+
+    void addRating(RatingAggregate* ratings, float rating) {
+        int bucket = (int) (rating + 0.5f) - MIN_RATING;
+
+        if (bucket < 0) {
+            bucket = 0;
+        } else if (bucket > MAX_RATING - MIN_RATING) {
+            bucket = MAX_RATING - MIN_RATING;
+        }
+
+        ratings->count++;
+        ratings->sum += rating;
+        ratings->sumOfSquares += (double) rating * rating;
+        ratings->histogram[bucket]++;
+    }
+
+    float calculateAverageRating(const RatingAggregate* ratings) {
+        if (ratings->count == 0) {
+            return 0.0;
+        }
+
+        return ratings->sum / ratings->count;
+    }
+
+    float calculateRatingVariance(const RatingAggregate* ratings) {
+        if (ratings->count == 0) {
+            return 0.0;
+        }
+
+        double mean = ratings->sum / ratings->count;
+        double variance = ratings->sumOfSquares / ratings->count - mean * mean;
+        return variance > 0 ? variance : 0.0;
+    }
+
+    void saveCompaniesToFile(CompanyTable* companies) {
+        saveDirtyCompaniesToStore(companies);
+    }
+
+    void loadCompaniesFromFile(CompanyTable* companies) {
+        loadCompaniesFromStore(companies);
+    }
+    
+    int isValidPostalCode(const char *postalCode) {
+        int length = strlen(postalCode);
+
+
+        return (length == 8 && isdigit(postalCode[0]) && isdigit(postalCode[1]) &&
+            isdigit(postalCode[2]) && isdigit(postalCode[3]) && postalCode[4] == '-' &&
+            isdigit(postalCode[5]) && isdigit(postalCode[6]) && isdigit(postalCode[7]));
+    }
+
+    int encodePostalCode(const char *postalCode) {
+        int value = 0;
+
+        if (!isValidPostalCode(postalCode)) {
+            return -1;
+        }
+        for (int i = 0; i < 8; i++) {
+            if (i != 4) {
+                value = value * 10 + (postalCode[i] - '0');
+            }
+        }
+        return value;
+    }
+
+   
+    
+    void saveNotRemovedCompaniesToFile() {
+        saveDirtyCompaniesToStore(&companies);
+    }
+    
+    
+    int findIndexByNIF(int nif) {
+        Company* company = findCompanyByNif(&companies, nif);
+
+        if (company != NULL && bitmapContains(&companies.activeSlots, company->tableSlot)) {
+            return company->tableSlot;
+        }
+        return -1;
+    }
+
+    int companyHasComments(int index) {
+        return companyBySlot(&companies, index)->numComments > 0;
+    }
+
+    void loadRatingsFromFile(CompanyTable* companies) {
+        replayRatingJournal(companies);
+    }
+
+
+    void loadCommentsFromFile(CompanyTable* companies) {
+        countCommentsInLog(companies);
+    }
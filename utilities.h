@@ -1,302 +1,409 @@
-/* 
- * @file:   utilities.h
- * 
- * @author: Vitor and Diogo (Group 16)
- * @date 5-1-2024
- *
- * @brief Header file containing utility functions and data structures for the Company Management System.
- */
-
-#ifndef UTILITIES_H
-#define UTILITIES_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-    /**
-     * @brief Maximum number of companies in the system.
-     */
-    #define MAX_COMPANIES 100
-
-    /**
-     * @brief Maximum number of comments for a company.
-     */
-    #define MAX_COMMENTS 100
-
-    /**
-     * @brief Maximum number of ratings for a company.
-     */
-    #define MAX_RATINGS 100
-
-    /**
-     * @brief Minimum rating value.
-     */
-    #define MIN_RATING 1
-
-    /**
-     * @brief Maximum rating value.
-     */
-    #define MAX_RATING 5
-
-    /**
-     * @brief Initial buffer size for dynamic memory allocation.
-     */
-    #define INITIAL_BUFFER_SIZE 50
-
-    /**
-     * @brief Incremental size for buffer resizing.
-     */
-    #define BUFFER_INCREMENT 10
-
-    #include <stdio.h>
-    #include <stdlib.h>
-    #include <string.h>
-    #include <stdbool.h>
-    #include <ctype.h>
-
-    /**
-     * @brief Structure representing a comment made by a user.
-     */
-    typedef struct {
-        char username[50];
-        char title[100];
-        char text[500];
-    } Comment;
-
-    /**
-     * @brief Enumeration representing different company categories.
-     */
-    typedef enum {
-        MICRO = 1,
-        SMALL,
-        MEDIUM,
-        BIG
-    } Categoria;
-
-    /**
-     * @brief Structure representing a company's information.
-     */
-    typedef struct {
-        int nif;
-        char name[100];
-        char category[50];
-        char businessSector[50];
-        char street[50];
-        char locality[50];
-        char postalCode[10];
-        int active;  // 1 for active, 0 for inactive
-        Comment comments[50];
-        int numComments;
-        char activity[100];
-        float averageRating;
-        float ratings[MAX_RATINGS];
-        int numRatings;
-    } Company;
-
-    /**
-     * @brief Structure representing a list of business sectors.
-     */
-    typedef struct {
-        char** sectors;
-        int* activeStatus;
-        int numSectors;
-    } BusinessSectorList;
-
-    /**
-     * @brief Enumeration representing different search criteria.
-     */
-    typedef enum {
-        SEARCH_NAME = 1,
-        SEARCH_CATEGORY,
-        SEARCH_LOCALITY
-    } SearchCriterion;
-
-    /**
-     * @brief Structure representing a business sector.
-     */
-    typedef struct {
-        char name[100];
-        bool isActive; 
-    } BusinessSector;
-
-    /**
-     * @brief Gets the name associated with a company category.
-     *
-     * @param category The company category.
-     * @return The name associated with the category.
-     */
-    const char* getCategoryName(Categoria category);
-
-    /**
-     * @brief Saves business sectors to a file.
-     *
-     * @param businessSectors An array of business sectors.
-     * @param numBusinessSectors The number of business sectors.
-     * @return void - This function does not return a value.
-     */
-    void saveBusinessSectorsToFile(BusinessSector* businessSectors, int numBusinessSectors);
-
-    /**
-     * @brief Loads business sectors from a file.
-     *
-     * @param businessSectors A pointer to the array of business sectors.
-     * @param numBusinessSectors A pointer to the number of business sectors.
-     * @return void - This function does not return a value.
-     */
-    void loadBusinessSectorsFromFile(BusinessSector** businessSectors, int* numBusinessSectors);
-
-    /**
-     * @brief Checks if a business sector is in use by any company.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies The number of companies in the array.
-     * @param businessSector The name of the business sector.
-     * @return 1 if the business sector is in use, 0 otherwise.
-     */
-    int isBusinessSectorInUse(const Company* companies, int numCompanies, const char* businessSector);
-
-    /**
-     * @brief Frees the memory allocated for a business sector list.
-     *
-     * @param sectorList A pointer to the BusinessSectorList structure.
-     * @return void - This function does not return a value.
-     */
-    void freeBusinessSectorList(BusinessSectorList* sectorList);
-
-    /**
-     * @brief Shifts elements in an array to the left starting from a specified index.
-     *
-     * @param arr The array to be shifted.
-     * @param size The size of the array.
-     * @param index The index from which to start shifting.
-     * @return void - This function does not return a value.
-     */
-    void shiftArray(Company* arr, size_t size, size_t index);
-
-    /**
-     * @brief Calculates the average rating from an array of ratings.
-     *
-     * @param ratings An array of ratings.
-     * @param numRatings The number of ratings in the array.
-     * @return The calculated average rating.
-     */
-    float calculateAverageRating(float ratings[], int numRatings);
-
-    /**
-     * @brief Checks if a postal code is valid.
-     *
-     * @param postalCode The postal code to be checked.
-     * @return 1 if the postal code is valid, 0 otherwise.
-     */
-    int isValidPostalCode(const char *postalCode);
-
-    /**
-     * @brief Saves company information to a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies The number of companies in the array.
-     * @return void - This function does not return a value.
-     */
-    void saveCompaniesToFile(Company companies[], int numCompanies);
-
-    /**
-     * @brief Loads company information from a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies A pointer to the number of companies.
-     * @return void - This function does not return a value.
-     */
-    void loadCompaniesFromFile(Company companies[], int *numCompanies);
-
-    /**
-     * @brief Loads the count of companies from a file.
-     *
-     * @return The count of companies.
-     */
-    int loadCompanyCount();
-
-    /**
-     * @brief Saves the count of companies to a file.
-     *
-     * @param numCompanies The count of companies.
-     * @return void - This function does not return a value.
-     */
-    void saveCompanyCount(int numCompanies);
-
-    /**
-     * @brief Saves company information for non-removed companies to a file.
-     *
-     * @param numCompanies The number of companies in the array.
-     * @return void - This function does not return a value.
-     */
-    void saveNotRemovedCompaniesToFile(int numCompanies);
-
-    /**
-     * @brief Finds the index of a company by its NIF.
-     *
-     * @param nif The NIF of the company.
-     * @return The index of the company in the array.
-     */
-    int findIndexByNIF(int nif);
-
-    /**
-     * @brief Checks if a company has comments.
-     *
-     * @param index The index of the company.
-     * @return 1 if the company has comments, 0 otherwise.
-     */
-    int companyHasComments(int index);
-
-    /**
-     * @brief Saves company ratings to a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies The number of companies in the array.
-     * @return void - This function does not return a value.
-     */
-    void saveRatingsToFile(Company companies[], int numCompanies);
-
-    /**
-     * @brief Loads company ratings from a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies The number of companies in the array.
-     * @return void - This function does not return a value.
-     */
-    void loadRatingsFromFile(Company companies[], int numCompanies);
-
-    /**
-     * @brief Saves company comments to a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies The number of companies in the array.
-     * @return void - This function does not return a value.
-     */
-    void saveCommentsToFile(Company companies[], int numCompanies);
-
-    /**
-     * @brief Loads company comments from a file.
-     *
-     * @param companies An array of companies.
-     * @param numCompanies A pointer to the number of companies.
-     * @return void - This function does not return a value.
-     */
-    void loadCommentsFromFile(Company companies[], int *numCompanies);
-
-    /**
-     * @brief External declarations for the number of companies and comments.
-     */
-    extern int numCompanies;
-    extern int numComments;
-
-    /**
-     * @brief External declaration for the array of companies.
-     */
-    extern Company companies[MAX_COMPANIES];
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* UTILITIES_H */
+/* 
+ * @file:   utilities.h
+ * 
+ * @author: Vitor and Diogo (Group 16)
+ * @date 5-1-2024
+ *
+ * @brief Header file containing utility functions and data structures for the Company Management System.
+ */
+
+#ifndef UTILITIES_H
+#define UTILITIES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /**
+     * @brief Number of records in the first chunk of the company table; each new chunk doubles it.
+     */
+    #define COMPANY_FIRST_CHUNK 64
+
+    /**
+     * @brief Maximum number of chunks in the company table.
+     */
+    #define COMPANY_MAX_CHUNKS 24
+
+    /**
+     * @brief Maximum number of comments for a company.
+     */
+    #define MAX_COMMENTS 100
+
+    /**
+     * @brief Maximum number of ratings for a company.
+     */
+    #define MAX_RATINGS 100
+
+    /**
+     * @brief Minimum rating value.
+     */
+    #define MIN_RATING 1
+
+    /**
+     * @brief Maximum rating value.
+     */
+    #define MAX_RATING 5
+
+    /**
+     * @brief Initial buffer size for dynamic memory allocation.
+     */
+    #define INITIAL_BUFFER_SIZE 50
+
+    /**
+     * @brief Incremental size for buffer resizing.
+     */
+    #define BUFFER_INCREMENT 10
+
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <stdbool.h>
+    #include <ctype.h>
+    #include "bitmap.h"
+
+    /**
+     * @brief Structure representing a comment made by a user.
+     */
+    typedef struct {
+        char username[50];
+        char title[100];
+        char text[500];
+    } Comment;
+
+    /**
+     * @brief Enumeration representing different company categories.
+     */
+    typedef enum {
+        MICRO = 1,
+        SMALL,
+        MEDIUM,
+        BIG
+    } Categoria;
+
+    /**
+     * @brief Structure representing the running aggregate of the ratings of a company.
+     *
+     * Each vote updates it in constant time, so the individual ratings never need to be kept
+     * in memory.
+     */
+    typedef struct {
+        int count;
+        double sum;
+        double sumOfSquares;
+        int histogram[MAX_RATING - MIN_RATING + 1];  // votes per rating, rounded to a whole number
+    } RatingAggregate;
+
+    /**
+     * @brief Structure representing a company's information.
+     *
+     * Only the fields read by listings and searches are kept here. The comments and the
+     * rating history are read from the comment log and the rating journal when needed.
+     */
+    typedef struct {
+        int nif;
+        char name[100];
+        char nameKey[100];  // the name folded with foldText, matched by searches
+        Categoria category;  // 0 if the stored category is not a known one
+        int sectorId;  // id of the business sector in sectorSymbols, -1 until it is set
+        char street[50];
+        int localityId;  // id of the locality in localitySymbols
+        char localityKey[50];  // the locality folded with foldText, matched by searches
+        char postalCode[10];
+        int postalCodeValue;  // the postal code packed by encodePostalCode, -1 if it is not valid
+        int active;  // 1 for active, 0 for inactive; set through setCompanyActive
+        int numComments;  // the comments stay in the comment log
+        char activity[100];
+        RatingAggregate ratings;  // the rating history itself stays in the rating journal
+        int storeSlot;  // slot in the binary store, -1 if not saved yet
+        int dirty;  // 1 if the record changed since it was last saved
+        int tableSlot;  // slot in the company table, -1 while the record is free
+        int position;  // position in the listing order of the company table
+    } Company;
+
+    /**
+     * @brief Entry of the NIF index of the company table.
+     */
+    typedef struct {
+        int nif;
+        int slot;  // table slot of the company, -1 for an empty entry
+    } NifEntry;
+
+    /**
+     * @brief Structure representing the growable table of companies.
+     */
+    typedef struct {
+        Company* chunks[COMPANY_MAX_CHUNKS];  // chunk k holds COMPANY_FIRST_CHUNK << k records
+        int numChunks;
+        int capacity;       // number of slots in the allocated chunks
+        int numSlots;       // number of slots handed out so far
+        int* freeSlots;     // slots of removed companies, reused first
+        int numFreeSlots;
+        int freeCapacity;
+        Company** order;    // the live companies, in listing order
+        int count;          // number of live companies
+        int orderCapacity;
+        NifEntry* nifIndex; // open-addressing hash from NIF to table slot
+        int nifCapacity;    // a power of two
+        int nifCount;
+        int* sectorUsage;   // number of companies in each business sector, by id in sectorSymbols
+        int sectorUsageCapacity;
+        Bitmap activeSlots;  // slots of the active companies
+    } CompanyTable;
+
+    /**
+     * @brief Structure representing the list of business sectors.
+     *
+     * It is loaded from business_sectors.txt once and kept in memory. A sector is found by name
+     * through its id in sectorSymbols, and changes are only written back by saveBusinessSectorList.
+     */
+    typedef struct {
+        const char** sectors;  // the names, in the order of the file, owned by sectorSymbols
+        int* activeStatus;
+        int* sectorIds;    // id of each sector in sectorSymbols
+        int numSectors;
+        int capacity;
+        int* positions;    // position of each sector in the list, by id in sectorSymbols, -1 if none
+        int positionCapacity;
+        Bitmap activeSectors;  // positions of the active sectors
+        int dirty;         // 1 if the list changed since it was last saved
+    } BusinessSectorList;
+
+    /**
+     * @brief Enumeration representing different search criteria, numbered as in the search menu.
+     */
+    typedef enum {
+        SEARCH_NAME = 1,
+        SEARCH_CATEGORY,
+        SEARCH_LOCALITY,
+        SEARCH_FACETS,
+        SEARCH_COMMENTS,
+        SEARCH_NAME_FUZZY,
+        SEARCH_POSTAL_CODE,
+        SEARCH_NAME_PREFIX,
+        SEARCH_QUERY
+    } SearchCriterion;
+
+    /**
+     * @brief Gets the name associated with a company category.
+     *
+     * @param category The company category.
+     * @return The name associated with the category.
+     */
+    const char* getCategoryName(Categoria category);
+
+    /**
+     * @brief Gets the company category with a given name.
+     *
+     * @param name The name of the category, such as "SMALL".
+     * @return The category, or 0 if the name is not a category.
+     */
+    Categoria parseCategory(const char* name);
+
+    /**
+     * @brief Saves the list of business sectors to its file, if it changed since it was last saved.
+     *
+     * @param sectorList The list of business sectors.
+     * @return void - This function does not return a value.
+     */
+    void saveBusinessSectorList(BusinessSectorList* sectorList);
+
+    /**
+     * @brief Loads the list of business sectors from its file.
+     *
+     * @param sectorList The list of business sectors, which must be empty.
+     * @return void - This function does not return a value.
+     */
+    void loadBusinessSectorList(BusinessSectorList* sectorList);
+
+    /**
+     * @brief Adds a business sector at the end of the list.
+     *
+     * @param sectorList The list of business sectors.
+     * @param name The name of the business sector.
+     * @param active 1 if the business sector is active, 0 otherwise.
+     * @return The position of the new sector, or -1 if the name is already in the list or memory
+     *         could not be allocated.
+     */
+    int addBusinessSector(BusinessSectorList* sectorList, const char* name, int active);
+
+    /**
+     * @brief Activates or deactivates the business sector at a position of the list.
+     *
+     * @param sectorList The list of business sectors.
+     * @param position The position of the sector.
+     * @param active 1 to activate the sector, 0 to deactivate it.
+     * @return void - This function does not return a value.
+     */
+    void setBusinessSectorActive(BusinessSectorList* sectorList, int position, int active);
+
+    /**
+     * @brief Finds a business sector by name.
+     *
+     * @param sectorList The list of business sectors.
+     * @param name The name of the business sector.
+     * @return The position of the sector in the list, or -1 if it is not there.
+     */
+    int findBusinessSector(const BusinessSectorList* sectorList, const char* name);
+
+    /**
+     * @brief Removes the business sector at a position of the list.
+     *
+     * @param sectorList The list of business sectors.
+     * @param position The position of the sector.
+     * @return void - This function does not return a value.
+     */
+    void removeBusinessSectorAt(BusinessSectorList* sectorList, int position);
+
+    /**
+     * @brief Checks if a business sector is in use by any company.
+     *
+     * @param companies The company table.
+     * @param businessSector The name of the business sector.
+     * @return 1 if the business sector is in use, 0 otherwise.
+     */
+    int isBusinessSectorInUse(const CompanyTable* companies, const char* businessSector);
+
+    /**
+     * @brief Frees the memory allocated for a business sector list.
+     *
+     * @param sectorList A pointer to the BusinessSectorList structure.
+     * @return void - This function does not return a value.
+     */
+    void freeBusinessSectorList(BusinessSectorList* sectorList);
+
+    /**
+     * @brief Adds one vote to a rating aggregate.
+     *
+     * @param ratings The rating aggregate.
+     * @param rating The rating given, from MIN_RATING to MAX_RATING.
+     * @return void - This function does not return a value.
+     */
+    void addRating(RatingAggregate* ratings, float rating);
+
+    /**
+     * @brief Calculates the average rating from a rating aggregate.
+     *
+     * @param ratings The rating aggregate.
+     * @return The calculated average rating, or 0 if there are no ratings.
+     */
+    float calculateAverageRating(const RatingAggregate* ratings);
+
+    /**
+     * @brief Calculates the variance of the ratings from a rating aggregate.
+     *
+     * @param ratings The rating aggregate.
+     * @return The population variance of the ratings, or 0 if there are no ratings.
+     */
+    float calculateRatingVariance(const RatingAggregate* ratings);
+
+    /**
+     * @brief Folds a text for case and accent insensitive matching.
+     *
+     * ASCII letters are lowercased and the accented Latin letters, in UTF-8 or in Latin-1,
+     * are replaced by their base letter, so "Vestuário" and "VESTUARIO" both become "vestuario".
+     * The folded text is never longer than the original.
+     *
+     * @param dest The buffer receiving the folded text.
+     * @param size The size of the buffer.
+     * @param text The text.
+     * @return void - This function does not return a value.
+     */
+    void foldText(char* dest, size_t size, const char* text);
+
+    /**
+     * @brief Checks if a postal code is valid.
+     *
+     * @param postalCode The postal code to be checked.
+     * @return 1 if the postal code is valid, 0 otherwise.
+     */
+    int isValidPostalCode(const char *postalCode);
+
+    /**
+     * @brief Packs a postal code into an integer, so "4700-123" becomes 4700123.
+     *
+     * Packed postal codes sort in the same order as the postal codes themselves.
+     *
+     * @param postalCode The postal code.
+     * @return The packed postal code, or -1 if it is not valid.
+     */
+    int encodePostalCode(const char *postalCode);
+
+    /**
+     * @brief Saves the companies that changed to the binary store.
+     *
+     * Only the companies marked as dirty are written.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void saveCompaniesToFile(CompanyTable* companies);
+
+    /**
+     * @brief Loads company information from the binary store.
+     *
+     * The legacy companies.txt file is converted to the store the first time.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void loadCompaniesFromFile(CompanyTable* companies);
+
+    /**
+     * @brief Saves company information for non-removed companies to the binary store.
+     *
+     * @return void - This function does not return a value.
+     */
+    void saveNotRemovedCompaniesToFile();
+
+    /**
+     * @brief Finds the table slot of an active company by its NIF.
+     *
+     * @param nif The NIF of the company.
+     * @return The slot of the company in the company table, or -1 if it is not found.
+     */
+    int findIndexByNIF(int nif);
+
+    /**
+     * @brief Checks if a company has comments.
+     *
+     * @param index The table slot of the company.
+     * @return 1 if the company has comments, 0 otherwise.
+     */
+    int companyHasComments(int index);
+
+    /**
+     * @brief Loads company ratings by replaying the rating journal.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void loadRatingsFromFile(CompanyTable* companies);
+
+    /**
+     * @brief Counts the comments of each company in the comment log.
+     *
+     * @param companies The company table.
+     * @return void - This function does not return a value.
+     */
+    void loadCommentsFromFile(CompanyTable* companies);
+
+    /**
+     * @brief External declaration for the number of comments.
+     */
+    extern int numComments;
+
+    /**
+     * @brief External declaration for the table of companies.
+     */
+    extern CompanyTable companies;
+
+    /**
+     * @brief External declaration for the list of business sectors.
+     */
+    extern BusinessSectorList sectorList;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UTILITIES_H */